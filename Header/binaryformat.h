@@ -0,0 +1,123 @@
+#ifndef BINARYFORMAT_H
+#define BINARYFORMAT_H
+
+#include <QByteArray>
+#include <QDate>
+#include <QHash>
+#include <QPair>
+#include <QString>
+#include <QVector>
+
+// 二进制快照格式
+//
+// 文件布局（所有整数均为小端序）：
+//   文件头   魔数 "LIBSNAP\0"(8字节) + 版本号(uint32) + 段数量(uint32)
+//   段目录   每段 { 段类型(uint32), 保留(uint32), 偏移(uint64), 长度(uint64) }
+//   段数据   按目录中的偏移存放
+//
+// 各段内部均为 “记录数(uint32) + 定长列” 的列式布局：
+//   字符串段   count, { 长度(uint32) + UTF-8 字节 } * count
+//   图书段     count, id[], title[], author[]（字符串下标 uint32）,
+//              totalCopies[], availableCopies[]（int32）, category[], status[]（uint8）
+//   读者段     count, id[], name[], dept[], phone[]（uint32）, registerDate[]（int32）, isValid[]（uint8）
+//   借阅段     count, readerId[], bookId[]（uint32）, borrowDate[], dueDate[], returnDate[]（int32）
+//   预定段     count, readerId[], bookId[]（uint32）
+//   设置段     useCustomTime(uint8) + 3字节填充 + customCurrentDate(int32)
+//   历史段     已归还的借阅记录（版本 2 起），格式见 historysegment.h
+// 日期一律保存为儒略日，空日期保存为 NullDay。
+// 版本 1 的文件没有历史段，所有借阅记录都在借阅段中；版本 2 的借阅段只保存未归还的记录。
+namespace BinaryFormat {
+
+const char Magic[8] = {'L', 'I', 'B', 'S', 'N', 'A', 'P', '\0'};
+const quint32 Version = 2;
+const qint32 NullDay = -2147483647 - 1;
+
+enum SectionType : quint32 {
+    StringSection = 1,
+    BookSection,
+    ReaderSection,
+    BorrowSection,
+    ReservationSection,
+    SettingsSection,
+    HistorySection
+};
+
+// 日期与儒略日之间的转换
+qint32 dateToDay(const QDate &date);
+QDate dayToDate(qint32 day);
+
+// 判断数据开头是否为二进制快照魔数
+bool hasMagic(const QByteArray &head);
+
+// 定长字段写入（小端序，追加到 buffer 末尾）
+void appendU32(QByteArray &buffer, quint32 value);
+void appendU64(QByteArray &buffer, quint64 value);
+
+// 定长字段读取（不要求对齐）
+quint8 readU8(const uchar *p);
+quint32 readU32(const uchar *p);
+qint32 readI32(const uchar *p);
+
+// 按行读取定长列中的第 row 个元素
+inline qint32 i32At(const uchar *column, qint64 row) { return readI32(column + 4 * row); }
+inline quint8 u8At(const uchar *column, qint64 row) { return column[row]; }
+inline QDate dateAt(const uchar *column, qint64 row) { return dayToDate(i32At(column, row)); }
+
+// 快照写入器：收集字符串表与各段数据，最后一次性生成完整文件内容
+class Writer
+{
+public:
+    // 返回字符串在字符串表中的下标，相同的字符串只保存一次
+    quint32 addString(const QString &str);
+    int stringCount() const { return strings.size(); }
+
+    // 开始一个新段，之后写入的数据都属于该段
+    void beginSection(SectionType type);
+    void writeU8(quint8 value);
+    void writeU32(quint32 value);
+    void writeI32(qint32 value);
+    void writeString(const QString &str) { writeU32(addString(str)); }
+    void writeDate(const QDate &date) { writeI32(dateToDay(date)); }
+    void alignSection();
+
+    QByteArray finish() const;
+
+private:
+    QHash<QString, quint32> stringIndex;
+    QVector<QString> strings;
+    QVector<QPair<SectionType, QByteArray>> sections;
+};
+
+// 快照读取器：直接在 QFile::map 映射出的内存上解析，不做逐行处理
+class Reader
+{
+public:
+    Reader(const uchar *data, qint64 size);
+
+    bool isValid() const { return valid; }
+    quint32 version() const { return fileVersion; }
+
+    // 返回段数据的起始地址，size 为段长度；段不存在时返回 nullptr
+    const uchar *section(SectionType type, qint64 *size) const;
+    qint64 offsetOf(const uchar *p) const { return p - data; }
+
+    // 字符串表（加载时一次性解码，记录之间共享同一个 QString）
+    int stringCount() const { return strings.size(); }
+    const QVector<QString> &stringTable() const { return strings; }
+    QString string(quint32 index) const;
+    QString stringAt(const uchar *column, qint64 row) const { return string(readU32(column + 4 * row)); }
+
+private:
+    bool loadStrings();
+
+    const uchar *data;
+    qint64 size;
+    bool valid;
+    quint32 fileVersion;
+    QHash<quint32, QPair<qint64, qint64>> directory;  // 段类型 -> (偏移, 长度)
+    QVector<QString> strings;
+};
+
+} // namespace BinaryFormat
+
+#endif // BINARYFORMAT_H
@@ -1,45 +1,77 @@
-#ifndef BORROWRECORD_H
-#define BORROWRECORD_H
-
-#include <QString>
-#include <QDate>
-#include <QTextStream>
-
-class BorrowRecord
-{
-public:
-    BorrowRecord();
-    BorrowRecord(QString readerId, QString bookId, QDate borrowDate,
-                 QDate dueDate, QDate returnDate = QDate());
-
-    // 获取信息
-    QString getReaderId() const { return readerId; }
-    QString getBookId() const { return bookId; }
-    QDate getBorrowDate() const { return borrowDate; }
-    QDate getDueDate() const { return dueDate; }
-    QDate getReturnDate() const { return returnDate; }
-    bool isReturned() const { return !returnDate.isNull(); }
-
-    // 设置信息
-    void setReaderId(QString id) { readerId = id; }
-    void setBookId(QString id) { bookId = id; }
-    void setBorrowDate(QDate date) { borrowDate = date; }
-    void setDueDate(QDate date) { dueDate = date; }
-    void setReturnDate(QDate date) { returnDate = date; }
-
-    // 操作
-    void returnBook() { returnDate = QDate::currentDate(); }
-
-    // 文件操作
-    void saveToStream(QTextStream &out) const;
-    void loadFromStream(QTextStream &in);
-
-private:
-    QString readerId;       // 读者ID
-    QString bookId;         // 图书ID
-    QDate borrowDate;       // 借阅日期
-    QDate dueDate;          // 应还日期
-    QDate returnDate;       // 归还日期
-};
-
-#endif // BORROWRECORD_H
+#ifndef BORROWRECORD_H
+#define BORROWRECORD_H
+
+#include <QString>
+#include <QDate>
+#include <QTextStream>
+#include "idpool.h"
+#include "recordparser.h"
+
+// 借阅记录，内存中只占 16 字节
+//
+// 读者、图书保存为驻留池句柄，借阅日期保存为儒略日，应还日期和归还日期
+// 保存为相对借阅日期的天数（int16，NullOffset 表示空日期，相差超过约 89 年
+// 的日期被截断）。借阅日期为空时其余两个日期也视为空。日期在读取时才转换成
+// QDate，成批扫描借阅记录时只访问连续的定长数据。
+class BorrowRecord
+{
+public:
+    BorrowRecord();
+    BorrowRecord(QString readerId, QString bookId, QDate borrowDate,
+                 QDate dueDate, QDate returnDate = QDate());
+    BorrowRecord(IdPool::Handle reader, IdPool::Handle book, QDate borrowDate,
+                 QDate dueDate, QDate returnDate = QDate());
+
+    // 获取信息
+    QString getReaderId() const { return IdPool::string(reader); }
+    QString getBookId() const { return IdPool::string(book); }
+    IdPool::Handle getReaderHandle() const { return reader; }
+    IdPool::Handle getBookHandle() const { return book; }
+    QDate getBorrowDate() const { return borrowDay == NullDay ? QDate() : QDate::fromJulianDay(borrowDay); }
+    QDate getDueDate() const { return dateAt(dueOffset); }
+    QDate getReturnDate() const { return dateAt(returnOffset); }
+    bool isReturned() const { return borrowDay != NullDay && returnOffset != NullOffset; }
+
+    // 设置信息
+    void setReaderId(QString id) { reader = IdPool::intern(id); }
+    void setBookId(QString id) { book = IdPool::intern(id); }
+    void setHandles(IdPool::Handle readerHandle, IdPool::Handle bookHandle)
+    {
+        reader = readerHandle;
+        book = bookHandle;
+    }
+    void setBorrowDate(QDate date);
+    void setDueDate(QDate date) { dueOffset = offsetOf(date); }
+    void setReturnDate(QDate date) { returnOffset = offsetOf(date); }
+
+    // 操作
+    void returnBook() { setReturnDate(QDate::currentDate()); }
+
+    // 文件操作
+    void saveToStream(QTextStream &out) const;
+    void loadFromStream(QTextStream &in);
+    void loadFromLine(const char *line, int length);  // UTF-8 编码的一行
+    // 只解析日期，读者、图书编号以原始字节返回，不访问驻留池；
+    // 调用方换成句柄后再 setHandles。字段不足时返回 false
+    bool parseLine(const char *line, int length,
+                   RecordParser::Field *readerId, RecordParser::Field *bookId);
+
+private:
+    static constexpr qint32 NullDay = -2147483647 - 1;
+    static constexpr qint16 NullOffset = -32768;
+
+    static qint32 dayOf(const QDate &date);
+    qint16 offsetOf(const QDate &date) const;
+    QDate dateAt(qint16 offset) const;
+
+    IdPool::Handle reader;  // 读者ID（驻留池句柄）
+    IdPool::Handle book;    // 图书ID（驻留池句柄）
+    qint32 borrowDay;       // 借阅日期（儒略日）
+    qint16 dueOffset;       // 应还日期 - 借阅日期（天）
+    qint16 returnOffset;    // 归还日期 - 借阅日期（天）
+};
+
+// 默认构造函数要把各日期设为空，不能当作 primitive 类型跳过构造；可以按字节搬移
+Q_DECLARE_TYPEINFO(BorrowRecord, Q_RELOCATABLE_TYPE);
+
+#endif // BORROWRECORD_H
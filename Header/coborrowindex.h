@@ -0,0 +1,50 @@
+#ifndef COBORROWINDEX_H
+#define COBORROWINDEX_H
+
+#include <QHash>
+#include <QPair>
+#include <QString>
+#include <QVector>
+#include "idpool.h"
+
+// “借过这本书的读者也借过”：稀疏的图书共现矩阵，每本书只保留共现次数最多的几本
+//
+// 每位读者记住最近借过的至多 MaxHistory 本不同的图书，两本书被同一位读者借过
+// 即共现一次。加载时先 remember 每位读者最近的借阅，再由 recount 按图书并行精确计数，
+// 每本书取前 MaxNeighbors 名；之后每次借阅用 addLoan 增量更新。列表已满时
+// 新出现的图书替换次数最少的一项并继承其次数（Space-Saving），因此内存有上界，
+// 增量计数是近似值，重新加载后恢复精确。查询只读取已排好序的列表。
+// 图书、读者都用驻留池句柄表示。共现列表按图书句柄散列存放，只有被借过的
+// 图书才有列表，内存与驻留池中的编号总数（含读者编号）无关。
+class CoBorrowIndex
+{
+public:
+    static constexpr int MaxNeighbors = 16;
+    static constexpr int MaxHistory = 128;
+
+    void clear();
+
+    // 只记入读者的借阅历史，不计数；全部记入后调用 recount
+    void remember(IdPool::Handle reader, IdPool::Handle book);
+    void recount();
+
+    // 新的一次借阅：与该读者借过的每本书各共现一次
+    void addLoan(IdPool::Handle reader, IdPool::Handle book);
+
+    // 与 book 共现最多的至多 k 本书及次数，次数从多到少
+    QVector<QPair<IdPool::Handle, int>> neighbors(IdPool::Handle book, int k) const;
+
+private:
+    struct Neighbor
+    {
+        IdPool::Handle book;
+        int count;
+    };
+
+    void bump(IdPool::Handle book, IdPool::Handle other);
+
+    QHash<IdPool::Handle, QVector<Neighbor>> lists;     // 图书 -> 共现列表，按次数从多到少
+    QHash<IdPool::Handle, QVector<IdPool::Handle>> histories; // 读者 -> 最近借过的图书，按借阅先后
+};
+
+#endif // COBORROWINDEX_H
@@ -0,0 +1,80 @@
+#ifndef HISTORYSEGMENT_H
+#define HISTORYSEGMENT_H
+
+#include <QByteArray>
+#include <QFile>
+#include <QHash>
+#include <QSharedPointer>
+#include <QString>
+#include <QVector>
+#include "binaryformat.h"
+#include "borrowrecord.h"
+
+// 二进制快照中的历史段：已归还的借阅记录
+//
+// 段内布局（记录按借阅日期升序排列）：
+//   count(uint32), keyCount(uint32)
+//   readerId[], bookId[]（字符串下标 uint32）, borrowDate[], dueDate[], returnDate[]（int32）
+//   bookStart[keyCount + 1], bookPostings[count]      按图书分组的记录下标
+//   readerStart[keyCount + 1], readerPostings[count]  按读者分组的记录下标
+// 分组索引采用压缩行格式：字符串下标为 k 的图书，其记录下标为
+// bookPostings[bookStart[k] .. bookStart[k + 1])。
+//
+// 按需加载模式下文件一直保持映射，只有查询借阅历史时才读取对应的记录。
+// 需要整体重写被映射的文件时先调用 detach()，把段内容复制到内存后释放文件，
+// 否则某些平台上无法替换仍被打开的文件。
+class HistorySegment
+{
+public:
+    // 映射数据文件中位于 [offset, offset + length) 的历史段
+    static QSharedPointer<HistorySegment> open(const QString &filename,
+                                               qint64 offset, qint64 length,
+                                               const QVector<QString> &strings);
+    ~HistorySegment();
+
+    int size() const { return count; }
+    BorrowRecord recordAt(int index) const;
+    QDate borrowDateAt(int index) const { return BinaryFormat::dateAt(borrowDays, index); }
+    int lowerBound(const QDate &borrowDate) const;   // 第一条借阅日期不早于 borrowDate 的记录
+    QVector<BorrowRecord> recordsByBook(const QString &bookId) const;
+    QVector<BorrowRecord> recordsByReader(const QString &readerId) const;
+    // 读者最近借出的至多 limit 条记录，按借阅日期升序，只读取这几条
+    QVector<BorrowRecord> recentRecordsByReader(IdPool::Handle reader, int limit) const;
+
+    QString fileName() const { return file.fileName(); }
+    bool isDetached() const { return !mapped; }
+    void detach();
+
+    // 把已归还的记录写入新的历史段（records 须已按借阅日期排序）
+    static void write(BinaryFormat::Writer &writer, const QVector<BorrowRecord> &records);
+
+private:
+    HistorySegment(const QString &filename, const QVector<QString> &strings);
+    bool map(qint64 offset, qint64 length);
+    void setBase(const uchar *data);
+    QVector<BorrowRecord> postingRecords(const uchar *start, const uchar *postings,
+                                         IdPool::Handle key, int limit = -1) const;
+
+    QFile file;
+    uchar *mapped;
+    qint64 mappedLength;
+    QByteArray buffer;                     // detach() 之后的段内容
+    QVector<QString> strings;              // 快照的字符串表（与已加载的数据共享）
+    QVector<IdPool::Handle> handles;       // 字符串下标 -> 驻留池句柄，未被引用的为 InvalidHandle
+    QHash<IdPool::Handle, quint32> keyIndex;   // 驻留池句柄 -> 字符串下标
+
+    int count;
+    quint32 keyCount;
+    const uchar *base;
+    const uchar *readerIds;
+    const uchar *bookIds;
+    const uchar *borrowDays;
+    const uchar *dueDays;
+    const uchar *returnDays;
+    const uchar *bookStart;
+    const uchar *bookPostings;
+    const uchar *readerStart;
+    const uchar *readerPostings;
+};
+
+#endif // HISTORYSEGMENT_H
@@ -0,0 +1,30 @@
+#ifndef IDPOOL_H
+#define IDPOOL_H
+
+#include <QString>
+
+// 编号驻留池：把 "B1001"、"R1001" 这样的图书、读者编号映射为稠密的 32 位句柄
+//
+// 借阅记录、预定和各类索引只保存句柄，字符串编号只在界面和文件读写时取出。
+// 句柄一经分配不再回收（借阅历史仍会引用已删除的图书和读者），同一字符串
+// 始终得到同一句柄，因此句柄可以直接比较、作为散列键。整个程序共用一个池，
+// 借阅记录在并行解析、后台保存等线程中创建和读取，所以分配时加锁；句柄对应的
+// 字符串存放在分块数组中，分配后位置不变，取字符串时不加锁。
+namespace IdPool {
+
+typedef quint32 Handle;
+constexpr Handle EmptyHandle = 0;             // 空字符串
+constexpr Handle InvalidHandle = 0xffffffffu;  // find 找不到时返回
+
+// 返回 id 的句柄，没有时分配一个新句柄
+Handle intern(const QString &id);
+// 只查找不分配，id 从未出现过时返回 InvalidHandle
+Handle find(const QString &id);
+// 句柄对应的字符串编号，InvalidHandle 返回空字符串
+QString string(Handle handle);
+// 已分配的句柄数，句柄都小于这个值
+quint32 size();
+
+} // namespace IdPool
+
+#endif // IDPOOL_H
@@ -0,0 +1,93 @@
+#ifndef LIBRARYJOURNAL_H
+#define LIBRARYJOURNAL_H
+
+#include <QByteArray>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+#include "book.h"
+#include "borrowrecord.h"
+#include "reader.h"
+
+// 变更日志（预写日志）
+//
+// 日志文件与数据文件放在一起，文件名为 “<数据文件>.journal”，只追加不改写。
+// 每条记录格式（小端序）：
+//   负载长度(uint32) + 校验和(uint32，低16位为 CRC-16) + 负载
+//   负载 = 操作码(uint8) + 字段数(uint8) + { 长度(uint32) + UTF-8 字节 } * 字段数
+// 记录先缓存在内存中，保存时一次性追加到磁盘；加载时遇到不完整或校验失败的
+// 记录即停止回放（进程在写日志时崩溃只会丢失最后一条未写完的记录），并把
+// 日志截断到最后一条完整记录的末尾，之后追加的记录才能被回放。
+class LibraryJournal
+{
+public:
+    enum Operation : quint8 {
+        AddBook = 1,
+        RemoveBook,
+        UpdateBook,
+        AddReader,
+        RemoveReader,
+        UpdateReader,
+        BorrowBook,
+        ReturnBook,
+        ReserveBook,
+        AddBorrowRecord,
+        AddReservation,
+        SetCurrentDate,
+        ResetToRealTime,
+        ClearAll,
+        ImportBorrowRecord     // 导入的未归还记录，同时占用一册
+    };
+
+    struct Entry {
+        Operation op;
+        QStringList fields;
+    };
+
+    // 日志文件超过 max(数据文件大小 / CheckpointRatio, CheckpointMinBytes) 时重写快照
+    static constexpr qint64 CheckpointMinBytes = 64 * 1024;
+    static constexpr int CheckpointRatio = 4;
+
+    static QString journalPath(const QString &dataFile);
+
+    // 记录一次变更（仅写入内存缓冲区）
+    void append(Operation op, const QStringList &fields = QStringList());
+    bool hasPending() const { return pendingEntries > 0; }
+    int pendingCount() const { return pendingEntries; }
+    void discardPending();
+
+    // 取出缓冲区内容（后台保存时使用），保存失败时再放回缓冲区开头
+    QByteArray takePending(int *entryCount);
+    void restorePending(const QByteArray &data, int entryCount);
+
+    // 把缓冲区追加到磁盘日志
+    bool flush(const QString &dataFile);
+
+    // 是否应该重写完整快照而不是继续追加日志
+    bool needsCheckpoint(const QString &dataFile) const;
+
+    // 删除磁盘上的日志（写入新快照之后调用）
+    static bool removeJournal(const QString &dataFile);
+
+    // 读取磁盘日志中所有完整的记录，validLength 返回这些记录占用的字节数（日志无法读取时为 -1）
+    static QVector<Entry> readAll(const QString &dataFile, qint64 *validLength = nullptr);
+
+    // 把日志截断到 validLength 字节（丢弃末尾不完整或校验失败的记录），之后才能继续追加
+    static bool truncateJournal(const QString &dataFile, qint64 validLength);
+
+    // 实体与日志字段之间的转换
+    static QStringList bookFields(const Book &book);
+    static Book bookFromFields(const QStringList &fields);
+    static QStringList readerFields(const Reader &reader);
+    static Reader readerFromFields(const QStringList &fields);
+    static QStringList recordFields(const BorrowRecord &record);
+    static BorrowRecord recordFromFields(const QStringList &fields);
+    static QString dateField(const QDate &date);
+    static QDate dateFromField(const QString &field);
+
+private:
+    QByteArray pending;
+    int pendingEntries = 0;
+};
+
+#endif // LIBRARYJOURNAL_H
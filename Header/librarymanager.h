@@ -1,101 +1,275 @@
-#ifndef LIBRARYMANAGER_H
-#define LIBRARYMANAGER_H
-
-#include <QObject>
-#include <QVector>
-#include <QMap>
-#include <QList>
-#include <QString>
-#include <QPair>
-#include <QSettings>
-#include <QDate>
-#include <QTime>
-#include "book.h"
-#include "borrowrecord.h"
-#include "reader.h"
-
-class LibraryManager : public QObject
-{
-    Q_OBJECT
-
-public:
-    explicit LibraryManager(QObject *parent = nullptr);
-    ~LibraryManager();
-
-    // 图书管理
-    bool addBook(const Book &book);
-    bool removeBook(const QString &id);
-    bool updateBook(const Book &book);
-    Book* findBook(const QString &id);
-    QVector<Book*> searchBooks(const QString &keyword,
-                                BookCategory category = OTHER,
-                                bool searchByTitle = true,
-                                bool searchByAuthor = true);
-    QVector<Book*> getAllBooks() const;
-
-    // 读者管理
-    bool addReader(const Reader &reader);
-    bool removeReader(const QString &id);
-    bool updateReader(const Reader &reader);
-    Reader* findReader(const QString &id);
-    QVector<Reader*> getAllReaders() const;
-    QVector<Reader*> searchReaders(const QString &keyword);
-
-    // 借阅管理
-    bool borrowBook(const QString &readerId, const QString &bookId, QDate borrowDate = QDate());
-    bool returnBook(const QString &readerId, const QString &bookId, QDate returnDate = QDate());
-    bool reserveBook(const QString &readerId, const QString &bookId);
-
-    // 查询功能
-    QVector<BorrowRecord> getBorrowRecordsByBook(const QString &bookId) const;
-    QVector<BorrowRecord> getBorrowRecordsByReader(const QString &readerId) const;
-    QVector<BorrowRecord> getOverdueRecords() const;
-    QVector<QPair<QString, QString>> getReservations() const;
-    QVector<QString> getReservatorsByBook(const QString &bookId) const;
-
-    // 统计功能
-    int getTotalBookCount() const;
-    int getAvailableBookCount() const;
-    int getBorrowedBookCount() const;
-    int getCategoryCount() const;
-    QMap<BookCategory, int> getCategoryStatistics() const;
-    int getTotalReaderCount() const;
-
-    // 时间管理
-    QDate getCurrentDate() const;
-    void setCurrentDate(const QDate &date);
-    void resetToRealTime();
-    bool isUsingCustomTime() const;
-
-    // ============== 新增的函数声明 ==============
-    // 借阅记录管理
-    void addBorrowRecord(const BorrowRecord &record);
-    QVector<BorrowRecord> getAllBorrowRecords() const;
-
-    // 数据管理
-    void clearAllData();
-    bool saveToFile(const QString &filename);      // 新增
-    bool loadFromFile(const QString &filename);    // 新增
-    bool saveAllData();
-    bool loadAllData();
-    bool saveSettings();
-    bool loadSettings();
-
-    // 随机生成数据（测试用）
-    void generateRandomData(int bookCount, int readerCount = 5);
-
-signals:
-    void dataChanged();
-    void currentDateChanged(const QDate &newDate);
-
-private:
-    QMap<QString, Book*> books;                // 图书
-    QMap<QString, Reader*> readers;            // 读者
-    QList<BorrowRecord> borrowRecords;         // 借阅记录
-    QList<QPair<QString, QString>> reservations; // 预定记录
-    QSettings settings;                         // 配置文件
-    QDate customCurrentDate;                    // 自定义当前日期
-    bool useCustomTime;                         // 是否使用自定义时间
-};
-
-#endif // LIBRARYMANAGER_H
+#ifndef LIBRARYMANAGER_H
+#define LIBRARYMANAGER_H
+
+#include <QObject>
+#include <QVector>
+#include <QMap>
+#include <QHash>
+#include <QList>
+#include <QString>
+#include <QPair>
+#include <QSettings>
+#include <QDate>
+#include <QTime>
+#include <QTimer>
+#include <QFutureWatcher>
+#include <QThread>
+#include <QSharedPointer>
+#include <functional>
+#include "binaryformat.h"
+#include "book.h"
+#include "borrowrecord.h"
+#include "coborrowindex.h"
+#include "historysegment.h"
+#include "idpool.h"
+#include "libraryjournal.h"
+#include "ngramindex.h"
+#include "pinyinindex.h"
+#include "popularitytracker.h"
+#include "librarysnapshot.h"
+#include "prefixindex.h"
+#include "reader.h"
+#include "reservationqueue.h"
+#include "slotbitmap.h"
+#include "slottable.h"
+#include "storagebackend.h"
+
+class LibraryManager : public QObject
+{
+    Q_OBJECT
+
+public:
+    // loadData 为 false 时只读取程序设置，不加载默认数据文件
+    explicit LibraryManager(QObject *parent = nullptr, bool loadData = true);
+    ~LibraryManager();
+
+    // 图书管理
+    bool addBook(const Book &book);
+    bool removeBook(const QString &id);
+    bool updateBook(const Book &book);
+    Book* findBook(const QString &id);
+    QVector<Book*> searchBooks(const QString &keyword,
+                                BookCategory category = OTHER,
+                                bool searchByTitle = true,
+                                bool searchByAuthor = true,
+                                bool searchByPinyin = false,   // 同时按拼音模糊匹配
+                                int status = -1);              // BookStatus，-1 表示不限
+    QVector<Book*> getAllBooks() const;
+
+    // 读者管理
+    bool addReader(const Reader &reader);
+    bool removeReader(const QString &id);
+    bool updateReader(const Reader &reader);
+    Reader* findReader(const QString &id);
+    QVector<Reader*> getAllReaders() const;
+    QVector<Reader*> searchReaders(const QString &keyword, bool searchByPinyin = false);
+
+    // 借阅管理
+    bool borrowBook(const QString &readerId, const QString &bookId, QDate borrowDate = QDate());
+    bool returnBook(const QString &readerId, const QString &bookId, QDate returnDate = QDate());
+    bool reserveBook(const QString &readerId, const QString &bookId);
+
+    // 查询功能
+    QVector<BorrowRecord> getBorrowRecordsByBook(const QString &bookId) const;
+    QVector<BorrowRecord> getBorrowRecordsByReader(const QString &readerId) const;
+    QVector<BorrowRecord> getOverdueRecords(const QDate &asOf = QDate()) const;  // 默认为当前日期
+    QVector<BorrowRecord> getRecordsDueWithin(int days) const;  // 今天起 days 天内到期的未归还记录
+    // [first, last] 内借出的记录按借阅日期顺序逐条交给 visit，不生成列表，
+    // visit 返回 false 时停止；用于按期间统计的报表
+    void forEachRecordBorrowedBetween(const QDate &first, const QDate &last,
+                                      const std::function<bool(const BorrowRecord &)> &visit) const;
+    QVector<QPair<QString, QString>> getReservations() const;
+    QVector<QString> getReservatorsByBook(const QString &bookId) const;  // 按排队先后
+    QString getNextReservator(const QString &bookId) const;  // 下一册归还的副本留给的读者，没有时为空
+
+    // 输入补全：以 prefix 开头的至多 limit 个候选
+    enum CompletionKind { CompleteBookIds, CompleteBookTitles, CompleteReaderIds };
+    QStringList complete(CompletionKind kind, const QString &prefix, int limit = 10) const;
+
+    // 统计功能
+    int getTotalBookCount() const;
+    int getAvailableBookCount() const;
+    int getBorrowedBookCount() const;
+    int getCategoryCount() const;
+    QMap<BookCategory, int> getCategoryStatistics() const;
+    int getTotalReaderCount() const;
+
+    // 借阅排行（最近 7、30、365 天），计数随借阅增量维护，查询时不扫描借阅历史
+    QVector<QPair<QString, int>> getTopBooks(PopularityTracker::Window window, int k = 10);
+    QVector<QPair<QString, int>> getTopReaders(PopularityTracker::Window window,
+                                               BookCategory category, int k = 10);
+    QMap<BookCategory, int> getCategoryBorrowCounts(PopularityTracker::Window window);
+
+    // 借过这本书的读者也借过的至多 k 本书（已删除的图书不列出）及共同借阅的读者数
+    QVector<QPair<Book*, int>> getCoBorrowedBooks(const QString &bookId, int k = 5);
+
+    // 时间管理
+    QDate getCurrentDate() const;
+    void setCurrentDate(const QDate &date);
+    void resetToRealTime();
+    bool isUsingCustomTime() const;
+
+    // ============== 新增的函数声明 ==============
+    // 借阅记录管理
+    void addBorrowRecord(const BorrowRecord &record);
+    QVector<BorrowRecord> getAllBorrowRecords() const;
+
+    // 数据管理
+    void clearAllData();
+    bool saveToFile(const QString &filename);      // 新增
+    bool loadFromFile(const QString &filename);    // 新增
+    bool saveToBinaryFile(const QString &filename);   // 二进制快照
+    bool loadFromBinaryFile(const QString &filename);
+    bool saveToDatabase(const QString &filename);     // SQLite 存储后端
+    bool loadFromDatabase(const QString &filename);
+    bool isUsingStorageBackend() const;
+    LibrarySnapshot takeSnapshot() const;
+    LibrarySnapshot takeTextSnapshot(const QString &filename) const;
+    void detachDataFile();
+    bool saveAllData();
+    bool loadAllData();
+    void loadAllDataInBackground();   // 本对象不能有父对象，完成后发出 loadFinished
+    bool isLoading() const;
+    bool saveSettings();
+    bool loadSettings();
+
+    // 借阅历史按需加载（对之后打开的二进制快照生效）
+    void setLazyHistoryEnabled(bool enabled);
+    bool isLazyHistoryEnabled() const;
+
+    // 后台自动保存（间隔单位为分钟，0 表示关闭）
+    void setAutoSaveInterval(int minutes);
+    int getAutoSaveInterval() const;
+    bool isAutoSaving() const;
+
+    // 批量导入导出：每行一条记录，格式与 .lib 文件中的记录行相同
+    enum TransferKind { TransferBooks, TransferReaders, TransferBorrows };
+    bool importRecords(TransferKind kind, const QString &filename,
+                       int *imported = nullptr, int *rejected = nullptr);
+    bool exportRecords(TransferKind kind, const QString &filename) const;
+
+    // 随机生成数据（测试用）
+    void generateRandomData(int bookCount, int readerCount = 5);
+
+public slots:
+    void autoSave();
+
+signals:
+    void dataChanged();
+    void currentDateChanged(const QDate &newDate);
+    void autoSaveFinished(bool success, const QString &filename);
+    void loadFinished(bool success);
+
+private:
+    bool loadBinarySections(const BinaryFormat::Reader &reader, const QString &filename);
+    void releaseHistoryFile(const QString &filename);
+    void remapHistory(const QString &filename);
+    void closeStorage();
+    void releaseStorage();
+    void appendBorrowRecord(const BorrowRecord &record);
+    void cancelReservation(IdPool::Handle reader, IdPool::Handle book);
+    bool mayTakeCopy(IdPool::Handle reader, IdPool::Handle bookHandle, const Book *book,
+                     int *position) const;
+    void refreshHoldStatus(IdPool::Handle handle, Book *book);
+    bool refreshAllHoldStatus();
+
+    // 图书、读者全文索引
+    void indexBook(Book *book);
+    void unindexBook(const QString &id);
+    void facetBook(quint32 slot, const Book *book, bool present);
+    void refreshBookStatus(IdPool::Handle handle, const Book *book);
+    void indexReader(Reader *reader);
+    void unindexReader(const QString &id);
+
+    // 统计计数
+    void countBook(const Book *book, int sign);
+    void verifyStatistics() const;
+
+    // 借阅记录索引
+    void rebuildIndexes();
+    void rebuildBorrowIndexes();
+    void rebuildPopularity();
+    void refreshPopularity();
+    void rebuildCoBorrows();
+    void indexBorrowRecord(int index);
+    qint64 borrowDayAt(int index) const;
+    bool borrowedBefore(int a, int b) const;
+    void mergeLateBorrows();
+    QVector<BorrowRecord> postingRecords(const QHash<IdPool::Handle, QVector<int>> &postings,
+                                         IdPool::Handle key, int limit = -1) const;
+    QVector<BorrowRecord> recentBorrowRecordsByReader(const QString &readerId, int limit) const;
+
+    // 批量导入
+    bool importBook(const char *line, int length);
+    bool importReader(const char *line, int length);
+    bool importBorrow(const char *line, int length);
+    bool importOpenLoan(const BorrowRecord &record);
+
+    // 变更日志
+    void logChange(LibraryJournal::Operation op, const QStringList &fields = QStringList());
+    static int dirtySectionsFor(LibraryJournal::Operation op);
+    bool canSaveIncrementally(const QString &filename, bool binary) const;
+    void finishCheckpoint(const QString &filename, bool binary);
+    void attachJournal(const QString &filename, bool binary);
+    void applyJournalEntry(const LibraryJournal::Entry &entry);
+
+    // 后台自动保存
+    void waitForAutoSave();
+    void completeAutoSave();
+
+    QMap<QString, Book*> books;                // 图书
+    SlotTable<Book> bookSlots;                 // 索引内部使用的图书整数编号
+    NgramIndex bookTextIndex;                  // 书名、作者的 n-gram 索引
+    PrefixIndex bookIdPrefixes;                // 图书编号补全
+    PrefixIndex bookTitlePrefixes;             // 书名补全
+    PinyinIndex bookTitlePinyin;               // 书名拼音
+    PinyinIndex bookAuthorPinyin;              // 作者拼音
+    SlotBitmap categoryBitmaps[OTHER + 1];     // 各类别的图书编号
+    SlotBitmap statusBitmaps[LOST + 1];        // 各状态的图书编号
+    int totalCopies;                           // 全部图书的总册数
+    int availableCopies;                       // 全部图书的可借册数
+    int categoryCopies[OTHER + 1];             // 各类别的总册数
+    QMap<QString, Reader*> readers;            // 读者
+    SlotTable<Reader> readerSlots;             // 索引内部使用的读者整数编号
+    NgramIndex readerTextIndex;                // 编号、姓名、院系、电话的 n-gram 索引
+    PrefixIndex readerIdPrefixes;              // 读者编号补全
+    PinyinIndex readerNamePinyin;              // 读者姓名拼音
+    QList<BorrowRecord> borrowRecords;         // 借阅记录
+    QHash<IdPool::Handle, QVector<int>> borrowsByBook;   // 图书 -> borrowRecords 下标
+    QHash<IdPool::Handle, QVector<int>> borrowsByReader; // 读者 -> borrowRecords 下标
+    QHash<QPair<IdPool::Handle, IdPool::Handle>, QVector<int>> openLoans; // (读者, 图书) -> 未归还记录下标，按借阅先后
+    QMultiMap<qint64, int> openLoansByDue;     // 应还日期（儒略日）-> 未归还记录下标，同一天按下标
+    QVector<int> borrowsByDate;                // borrowRecords 下标，按（借阅日期, 下标）排序
+    QVector<int> lateBorrowsByDate;            // 借阅日期早于 borrowsByDate 末尾的新记录，同样排序
+    PopularityTracker popularity;               // 最近一段时间的借阅排行
+    CoBorrowIndex coBorrows;                    // 图书共同借阅关系
+    ReservationQueue reservations;              // 预定记录，每本图书一个队列
+    QSettings settings;                         // 配置文件
+    QDate customCurrentDate;                    // 自定义当前日期
+    bool useCustomTime;                         // 是否使用自定义时间
+
+    LibraryJournal journal;                     // 尚未写入磁盘的变更
+    QString journalFile;                        // 日志关联的数据文件
+    bool journalFileBinary;                     // 数据文件是否为二进制快照
+    bool journalSuspended;                      // 加载/回放期间不记录日志
+    int dirtySections;                          // 数据文件上次完整保存后修改过的段（LibrarySnapshot::DirtyFlag）
+
+    QTimer *autoSaveTimer;                      // 自动保存定时器
+    QFutureWatcher<bool> *autoSaveWatcher;      // 后台保存任务
+    int autoSaveMinutes;                        // 自动保存间隔（分钟）
+    bool autoSaveRunning;                       // 是否有后台保存正在进行
+    QString autoSaveFile;                       // 后台保存的目标文件
+    QByteArray autoSaveInFlight;                // 后台保存期间取出的日志缓冲区
+    int autoSaveInFlightCount;
+    int autoSaveDirty;                          // 后台保存期间取出的修改标记
+
+    QSharedPointer<HistorySegment> history;     // 磁盘上的已归还借阅记录（按需加载模式）
+    bool lazyHistory;                           // 是否按需加载借阅历史
+
+    StorageBackend *storage;                    // 存储后端，为空时使用内存中的数据
+
+    QThread *loadThread;                        // 后台加载期间本对象所在的线程
+    bool loading;                               // 是否正在后台加载
+};
+
+#endif // LIBRARYMANAGER_H
@@ -0,0 +1,49 @@
+#ifndef LIBRARYSNAPSHOT_H
+#define LIBRARYSNAPSHOT_H
+
+#include <QVector>
+#include <QList>
+#include <QPair>
+#include <QString>
+#include <QDate>
+#include <QSharedPointer>
+#include "book.h"
+#include "borrowrecord.h"
+#include "historysegment.h"
+#include "reader.h"
+
+// 某一时刻全部数据的只读副本
+//
+// 图书、读者和预定按值拷贝（字符串隐式共享，只增加引用计数），借阅列表
+// 直接共享 LibraryManager 中的 QList（写时复制），因此生成快照很快，
+// 之后可以在工作线程中序列化而不影响界面线程继续修改数据。
+struct LibrarySnapshot
+{
+    // 文本格式中自上次完整保存以来发生过修改的段
+    enum DirtyFlag {
+        BooksDirty = 0x01,
+        ReadersDirty = 0x02,
+        BorrowsDirty = 0x04,
+        ReservationsDirty = 0x08,
+        SettingsDirty = 0x10,
+        AllDirty = 0x1f
+    };
+
+    QVector<Book> books;
+    QVector<Reader> readers;
+    QList<BorrowRecord> borrowRecords;
+    QSharedPointer<HistorySegment> history;  // 按需加载模式下尚在磁盘上的历史记录
+    QList<QPair<QString, QString>> reservations;
+    bool useCustomTime = false;
+    QDate customCurrentDate;
+
+    // 写文本格式时，未修改的段直接从 baseFile 中按原始字节复制
+    int dirtySections = AllDirty;
+    QString baseFile;
+
+    // 写入文本格式 / 二进制快照；先写临时文件，成功后再原子替换目标文件
+    bool writeText(const QString &filename) const;
+    bool writeBinary(const QString &filename) const;
+};
+
+#endif // LIBRARYSNAPSHOT_H
@@ -0,0 +1,38 @@
+#ifndef NGRAMINDEX_H
+#define NGRAMINDEX_H
+
+#include <QHash>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+// 文本子串检索用的 n-gram 倒排索引
+//
+// 中文没有分词边界，因此把每个字段（按字符折叠大小写后）切成长度为 1、2、3
+// 的所有连续片段，记录每个片段出现在哪些文档中。查询时：
+//   1 个字符  -> 单字的倒排表
+//   2 个字符  -> 二元组的倒排表
+//   3 个以上  -> 查询串中所有三元组倒排表的交集
+// 得到的是候选集合（可能包含误报，例如三元组都出现但不相邻），调用方需要
+// 再用原文验证。文档编号由调用方分配，倒排表按编号升序保存。
+class NgramIndex
+{
+public:
+    void insert(quint32 doc, const QStringList &fields);
+    void remove(quint32 doc);
+    void clear();
+    int size() const { return docGrams.size(); }
+
+    // 可能包含 query 的文档编号（升序）；query 为空时返回空列表
+    QVector<quint32> candidates(const QString &query) const;
+
+private:
+    static QString fold(const QString &text);
+    static quint64 gramKey(const QChar *p, int n);
+    static void collectGrams(const QString &text, QVector<quint64> *grams);
+
+    QHash<quint64, QVector<quint32>> postings;   // 片段 -> 文档编号
+    QHash<quint32, QVector<quint64>> docGrams;   // 文档 -> 片段（删除时使用）
+};
+
+#endif // NGRAMINDEX_H
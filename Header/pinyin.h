@@ -0,0 +1,23 @@
+#ifndef PINYIN_H
+#define PINYIN_H
+
+#include <QChar>
+#include <QString>
+
+// 汉字转拼音，用于按拼音检索书名、作者和读者姓名
+//
+// 覆盖 CJK 统一汉字基本区（U+4E00 ~ U+9FA5），多音字只取最常用的读音。
+namespace Pinyin {
+
+// 单个汉字的拼音（小写、无声调），不是汉字时返回 nullptr
+const char *syllable(QChar c);
+
+// 全拼键："张三" -> "zhangsan"；英文字母和数字转为小写保留，其余字符忽略
+QString fullKey(const QString &text);
+
+// 首字母键："张三" -> "zs"；英文字母和数字的处理同全拼键
+QString initialsKey(const QString &text);
+
+} // namespace Pinyin
+
+#endif // PINYIN_H
@@ -0,0 +1,42 @@
+#ifndef PINYININDEX_H
+#define PINYININDEX_H
+
+#include <QHash>
+#include <QMap>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+// 拼音检索索引
+//
+// 文档加入时即计算每个字段的全拼键和首字母键（"张三" -> "zhangsan"、"zs"），
+// 与文档编号一起保存，查询时不再做任何汉字转拼音。键按字典序保存在有序映射中：
+//   精确前缀  -> 二分定位后顺序扫描以查询串开头的键
+//   容错匹配  -> 查询串较长时，允许与某个键的前缀有少量编辑距离（输错、漏打、
+//               多打一个字母）；沿有序的键模拟字典树做动态规划，公共前缀的
+//               计算结果复用，不可能匹配的整段键直接跳过
+// 只匹配字段开头，例如 "sanguo" 能找到《三国演义》，"yanyi" 则不能。
+class PinyinIndex
+{
+public:
+    void insert(quint32 doc, const QStringList &fields);
+    void remove(quint32 doc);
+    void clear();
+
+    // 与 query 匹配的文档编号（升序）；query 中的空格、单引号和大小写被忽略
+    QVector<quint32> match(const QString &query) const;
+
+    // 查询串长度为 length 时允许的编辑距离
+    static int maxDistance(int length);
+
+private:
+    void collect(QMap<QString, QVector<quint32>>::const_iterator begin,
+                 QMap<QString, QVector<quint32>>::const_iterator end,
+                 QVector<quint32> *docs) const;
+    QMap<QString, QVector<quint32>>::const_iterator prefixEnd(const QString &prefix) const;
+
+    QMap<QString, QVector<quint32>> keys;   // 拼音键 -> 文档编号
+    QHash<quint32, QStringList> docKeys;    // 文档 -> 拼音键（删除时使用）
+};
+
+#endif // PINYININDEX_H
@@ -0,0 +1,103 @@
+#ifndef POPULARITYTRACKER_H
+#define POPULARITYTRACKER_H
+
+#include <QDate>
+#include <QHash>
+#include <QMap>
+#include <QPair>
+#include <QString>
+#include <QVector>
+#include "idpool.h"
+
+// 容量有限的按次数排序计数表（Space-Saving）：最多跟踪 Capacity 个键，
+// 次数变化时 O(log n) 调整位置，取前 k 名只需 O(k)
+//
+// 表满时新出现的键顶替次数最少的键，并继承它的次数，因此计数可能偏大，
+// 偏差不超过记下的 error；真正的热门键不会被挤出。没有被跟踪的键减少次数时
+// 直接忽略。键数不超过容量时计数是精确的。
+class PopularityRanking
+{
+public:
+    static constexpr int Capacity = 256;
+
+    void add(IdPool::Handle key, int delta);
+    int count(IdPool::Handle key) const { return entries.value(key).count; }
+    // 次数从多到少，次数相同按编号首次出现的先后（句柄大小）排序
+    QVector<QPair<QString, int>> top(int k) const;
+    void clear();
+
+private:
+    struct Entry
+    {
+        int count = 0;
+        int error = 0;   // 顶替时继承的次数，计数最多偏大这么多
+    };
+
+    void insertEntry(IdPool::Handle key, const Entry &entry);
+
+    QHash<IdPool::Handle, Entry> entries;              // 键 -> 次数（只保存非零的）
+    QMap<QPair<int, IdPool::Handle>, int> ordered;     // (-次数, 键) -> 次数
+};
+
+// 最近 7、30、365 天内的借阅排行
+//
+// 只保存最长窗口（365 天）内的借阅事件，按借阅日分组。每个窗口各有一套
+// 计数（每本图书、每个类别、每个类别下每位读者），新借阅落在窗口内时加一；
+// 日期前进时只处理滑入和滑出窗口的那几天的事件，不重新扫描借阅历史。
+// 图书和读者排行都是容量有限的 PopularityRanking，计数表的大小不随图书、
+// 读者数量增长。事件只记图书和读者，类别在计数时按图书查出；事件另按图书
+// 索引一份，图书改了类别时 setCategory 只处理这本书的借阅。
+class PopularityTracker
+{
+public:
+    enum Window { Week, Month, Year, WindowCount };
+    static int windowDays(Window window);
+
+    // 清空计数，各窗口以 today 为最后一天
+    void reset(const QDate &today);
+    // 窗口前移到以 today 结束；today 早于当前的最后一天时返回 false，需要 reset 后重新加入
+    bool advanceTo(const QDate &today);
+    QDate lastDate() const { return QDate::fromJulianDay(lastDay); }
+
+    // 记录一次借阅，早于最长窗口的借阅被忽略，晚于最后一天的等窗口前移时再计入
+    void add(const QDate &borrowDate, IdPool::Handle book, int category, IdPool::Handle reader);
+    // 图书类别变化，没有被记录过的图书忽略
+    void setCategory(IdPool::Handle book, int category);
+
+    QVector<QPair<QString, int>> topBooks(Window window, int k) const;
+    QVector<QPair<QString, int>> topReaders(Window window, int category, int k) const;
+    int categoryCount(Window window, int category) const;
+
+private:
+    struct Event
+    {
+        IdPool::Handle book;
+        IdPool::Handle reader;
+    };
+
+    struct BookEvent
+    {
+        qint64 day;
+        IdPool::Handle reader;
+    };
+
+    struct Counters
+    {
+        PopularityRanking books;
+        QHash<int, PopularityRanking> readersByCategory;
+        QHash<int, int> categories;
+    };
+
+    void apply(Window window, qint64 from, qint64 to, int delta);
+    void apply(Counters &counters, const Event &event, int delta);
+    void applyCategory(Counters &counters, int category, IdPool::Handle reader, int delta);
+    void applyBook(IdPool::Handle book, int delta);
+
+    QMap<qint64, QVector<Event>> events;   // 借阅日（儒略日）-> 当天的借阅
+    QHash<IdPool::Handle, QVector<BookEvent>> eventsByBook;   // 图书 -> 借阅，按借阅日排序
+    QHash<IdPool::Handle, int> categories; // 图书 -> 类别
+    Counters counters[WindowCount];
+    qint64 lastDay = 0;
+};
+
+#endif // POPULARITYTRACKER_H
@@ -0,0 +1,37 @@
+#ifndef PREFIXINDEX_H
+#define PREFIXINDEX_H
+
+#include <QMap>
+#include <QString>
+#include <QStringList>
+
+// 输入补全用的前缀索引
+//
+// 以规范化后的文本（折叠大小写、合并空白）为键保存在有序映射中，前缀查询
+// 先二分定位到第一个不小于前缀的键，再顺序取出至多 limit 个以前缀开头的
+// 条目，耗时为 O(log n + limit)，与条目总数基本无关。
+// 同一文本可以插入多次（例如同名图书），删除到引用数为 0 时才移除。
+class PrefixIndex
+{
+public:
+    void insert(const QString &text);
+    void remove(const QString &text);
+    void clear() { entries.clear(); }
+    int size() const { return entries.size(); }
+
+    // 以 prefix 开头的条目（按规范化后的顺序），至多 limit 个
+    QStringList complete(const QString &prefix, int limit) const;
+
+private:
+    struct Entry
+    {
+        QString text;   // 第一次插入时的原文
+        int refs;
+    };
+
+    static QString normalize(const QString &text);
+
+    QMap<QString, Entry> entries;   // 规范化文本 -> 条目
+};
+
+#endif // PREFIXINDEX_H
@@ -0,0 +1,36 @@
+#ifndef RECORDPARSER_H
+#define RECORDPARSER_H
+
+#include <QString>
+#include <QDate>
+
+// 文本数据文件中一行记录的解析
+//
+// 直接在 UTF-8 原始字节上查找逗号切分字段，字段只记录位置不复制；
+// 整数和 yyyy-MM-dd 日期在字节上直接解码，只有需要保存的字符串字段
+// 才通过 toString() 生成 QString。
+namespace RecordParser {
+
+// 行内的一个字段 [data, data + size)
+struct Field {
+    const char *data;
+    int size;
+};
+
+// 按逗号切分一行，最多切出 maxFields 个字段，返回实际字段数
+int split(const char *line, int length, Field *fields, int maxFields);
+
+QString toString(const Field &field);
+
+// 解析十进制整数（允许前导负号），格式不对时返回 0
+int toInt(const Field &field);
+
+// 解析固定格式 yyyy-MM-dd 的日期，格式不对时返回无效日期
+QDate toDate(const Field &field);
+
+// 字段内容是否恰好为 text
+bool equals(const Field &field, const char *text);
+
+} // namespace RecordParser
+
+#endif // RECORDPARSER_H
@@ -0,0 +1,73 @@
+#ifndef RESERVATIONQUEUE_H
+#define RESERVATIONQUEUE_H
+
+#include <QHash>
+#include <QList>
+#include <QPair>
+#include <QString>
+#include <QVector>
+#include "idpool.h"
+
+// 预定队列：每本图书一个先进先出队列，另按读者建反向索引
+//
+// 每条预定是节点池中的一个节点，同时挂在三条双向链表上：所属图书的队列、
+// 所属读者的预定列表、全部预定按先后排成的总列表（保存文件时使用）。
+// 入队、查看队首、按句柄取消都是 O(1)，列出某本书或某位读者的预定是 O(k)。
+// 取消后句柄失效，节点之后可能被新的预定复用。接口和内部都只使用读者、图书编号在
+// 驻留池中的句柄，字符串编号只在 toList 等面向界面和文件的地方转换。
+class ReservationQueue
+{
+public:
+    typedef quint32 Handle;
+    static constexpr Handle InvalidHandle = 0xffffffffu;
+
+    Handle enqueue(IdPool::Handle reader, IdPool::Handle book);
+    bool cancel(Handle handle);
+    void clear();
+
+    int size() const { return all.count; }
+    bool isEmpty() const { return all.count == 0; }
+    int countFor(IdPool::Handle book) const { return byBook.value(book).count; }
+
+    // 某本书排在最前面的预定，没有时返回 InvalidHandle
+    Handle front(IdPool::Handle book) const { return byBook.value(book).head; }
+    // 读者对某本书的预定，按该读者的预定数线性查找
+    Handle find(IdPool::Handle reader, IdPool::Handle book) const;
+
+    QString readerId(Handle handle) const { return IdPool::string(nodes.at(handle).reader); }
+    QString bookId(Handle handle) const { return IdPool::string(nodes.at(handle).book); }
+
+    QVector<IdPool::Handle> readersOf(IdPool::Handle book) const;  // 按排队先后
+    QVector<IdPool::Handle> booksOf(IdPool::Handle reader) const;  // 按预定先后
+    QVector<IdPool::Handle> queuedBooks() const;                   // 有预定的图书，不重复
+    QList<QPair<QString, QString>> toList() const;                 // (读者, 图书)，按预定先后
+
+private:
+    struct Node
+    {
+        IdPool::Handle reader;
+        IdPool::Handle book;
+        Handle prevByBook, nextByBook;
+        Handle prevByReader, nextByReader;
+        Handle prev, next;
+        bool used;
+    };
+
+    struct Ends
+    {
+        Handle head = InvalidHandle;
+        Handle tail = InvalidHandle;
+        int count = 0;
+    };
+
+    void append(Ends &ends, Handle handle, Handle Node::*prev, Handle Node::*next);
+    void unlink(Ends &ends, Handle handle, Handle Node::*prev, Handle Node::*next);
+
+    QVector<Node> nodes;             // 节点池，句柄即下标
+    QVector<Handle> freeNodes;       // 已取消、可复用的节点
+    QHash<IdPool::Handle, Ends> byBook;     // 图书 -> 队列
+    QHash<IdPool::Handle, Ends> byReader;   // 读者 -> 预定列表
+    Ends all;                        // 全部预定
+};
+
+#endif // RESERVATIONQUEUE_H
@@ -0,0 +1,48 @@
+#ifndef SECTIONSCANNER_H
+#define SECTIONSCANNER_H
+
+#include <QByteArray>
+#include <QVector>
+
+// 文本数据文件（.lib）的分段扫描
+//
+// 只查找 “#段名” 标记和换行符，不解析记录内容。计数段（BOOKS、READERS、
+// BORROWS、RESERVATIONS）按计数行给出的记录数跳过相应行，同时每隔
+// linesPerChunk 行记录一个块边界，便于之后把各块交给线程池并行解析；
+// 其它段（SETTINGS）的内容一直延续到下一个段标记。
+namespace SectionScanner {
+
+// 一段连续的完整记录行 [begin, end)
+struct Chunk {
+    const char *begin;
+    const char *end;
+};
+
+struct Section {
+    QByteArray name;        // 段名，不含 '#'
+    int count;              // 计数行给出的记录数，非计数段为 -1
+    qint64 headerOffset;    // 段标记行在文件中的偏移
+    qint64 endOffset;       // 段结束位置在文件中的偏移
+    QVector<Chunk> chunks;  // 按记录边界切分的块
+};
+
+QVector<Section> scan(const char *data, qint64 size, int linesPerChunk);
+
+// 读取从 p 开始的一行，返回行长度（不含行尾的 \r\n），p 移动到下一行开头
+int nextLine(const char *&p, const char *end);
+
+// 依次处理块中的每一行
+template <typename Func>
+void forEachLine(const Chunk &chunk, Func func)
+{
+    const char *p = chunk.begin;
+    while (p < chunk.end) {
+        const char *line = p;
+        int length = nextLine(p, chunk.end);
+        func(line, length);
+    }
+}
+
+} // namespace SectionScanner
+
+#endif // SECTIONSCANNER_H
@@ -0,0 +1,38 @@
+#ifndef SLOTBITMAP_H
+#define SLOTBITMAP_H
+
+#include <QMap>
+#include <QVector>
+
+// 以内部整数编号为元素的分块位图，用作类别、状态等筛选条件的索引
+//
+// 编号空间按 4096 位分块，只保存非空的块，因此稀疏的集合也很省内存。
+// 求交集时遍历块数较少的一方，逐字按位与，耗时与较小集合的块数成正比。
+class SlotBitmap
+{
+public:
+    void insert(quint32 slot);
+    void remove(quint32 slot);
+    bool contains(quint32 slot) const;
+    void clear();
+    int count() const { return total; }
+
+    QVector<quint32> toVector() const;   // 全部编号（升序）
+
+    static SlotBitmap intersected(const SlotBitmap &a, const SlotBitmap &b);
+
+private:
+    static constexpr int WordsPerBlock = 64;
+    static constexpr int BlockBits = WordsPerBlock * 64;
+
+    struct Block
+    {
+        quint64 words[WordsPerBlock];
+        int count;
+    };
+
+    QMap<quint32, Block> blocks;   // 块号 -> 块内容
+    int total = 0;
+};
+
+#endif // SLOTBITMAP_H
@@ -0,0 +1,82 @@
+#ifndef SLOTTABLE_H
+#define SLOTTABLE_H
+
+#include <QHash>
+#include <QVector>
+#include "idpool.h"
+
+// 为图书、读者分配紧凑的整数编号，供各类索引使用
+//
+// 删除对象后编号进入空闲列表，之后新增的对象优先复用，编号范围始终
+// 与对象数量相当。对象按编号在驻留池中的句柄登记，查找时不再散列字符串。
+template <typename T>
+class SlotTable
+{
+public:
+    // 返回 key 的编号，没有时分配一个新编号
+    quint32 attach(IdPool::Handle key, T *item)
+    {
+        quint32 slot;
+        auto it = ids.constFind(key);
+        if (it != ids.constEnd()) {
+            slot = it.value();
+        } else if (!freeSlots.isEmpty()) {
+            slot = freeSlots.takeLast();
+            ids.insert(key, slot);
+        } else {
+            slot = static_cast<quint32>(items.size());
+            items.append(nullptr);
+            ids.insert(key, slot);
+        }
+        items[slot] = item;
+        return slot;
+    }
+
+    // 释放 key 的编号，key 不存在时返回 false
+    bool detach(IdPool::Handle key, quint32 *slot)
+    {
+        auto it = ids.find(key);
+        if (it == ids.end()) {
+            return false;
+        }
+        *slot = it.value();
+        items[*slot] = nullptr;
+        freeSlots.append(*slot);
+        ids.erase(it);
+        return true;
+    }
+
+    T *at(quint32 slot) const { return items.at(slot); }
+
+    // 查找 key 的编号，key 不存在时返回 false
+    bool lookup(IdPool::Handle key, quint32 *slot) const
+    {
+        auto it = ids.constFind(key);
+        if (it == ids.constEnd()) {
+            return false;
+        }
+        *slot = it.value();
+        return true;
+    }
+
+    // 句柄对应的对象，未登记时返回 nullptr
+    T *value(IdPool::Handle key) const
+    {
+        auto it = ids.constFind(key);
+        return it == ids.constEnd() ? nullptr : items.at(it.value());
+    }
+
+    void clear()
+    {
+        items.clear();
+        ids.clear();
+        freeSlots.clear();
+    }
+
+private:
+    QVector<T *> items;                  // 编号 -> 对象，空位为 nullptr
+    QHash<IdPool::Handle, quint32> ids;  // 编号句柄 -> 整数编号
+    QVector<quint32> freeSlots;          // 可复用的编号
+};
+
+#endif // SLOTTABLE_H
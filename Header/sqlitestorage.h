@@ -0,0 +1,76 @@
+#ifndef SQLITESTORAGE_H
+#define SQLITESTORAGE_H
+
+#include <QByteArray>
+#include <QScopedPointer>
+#include <QSqlDatabase>
+#include <QSqlQuery>
+#include "storagebackend.h"
+
+// 基于 Qt 自带 QSQLITE 驱动的存储后端（.db 文件）
+//
+// 借阅表在 bookId、readerId、returnDate 上建有索引，dueDate 上建有只包含
+// 未归还记录的部分索引，按图书、读者查询借阅记录和查询逾期记录都是索引查找。
+// 所有语句在打开时预编译，修改在一个事务中累积到 commit() 时提交。
+class SqliteStorage : public StorageBackend
+{
+public:
+    SqliteStorage();
+    ~SqliteStorage() override;
+
+    // 打开数据库文件，不存在时创建并建立表和索引
+    bool open(const QString &filename);
+
+    // 文件开头是否为 SQLite 数据库标识
+    static bool isDatabaseFile(const QByteArray &header);
+
+    QString fileName() const override { return filename; }
+
+    bool loadCatalog(LibrarySnapshot *catalog) override;
+    bool importSnapshot(const LibrarySnapshot &snapshot) override;
+
+    void saveBook(const Book &book) override;
+    void removeBook(const QString &id) override;
+    void saveReader(const Reader &reader) override;
+    void removeReader(const QString &id) override;
+    void addBorrowRecord(const BorrowRecord &record) override;
+    bool returnBorrowRecord(const QString &readerId, const QString &bookId,
+                            const QDate &returnDate) override;
+    void addReservation(const QString &readerId, const QString &bookId) override;
+    void removeReservation(const QString &readerId, const QString &bookId) override;
+    void saveTimeSettings(bool useCustomTime, const QDate &customDate) override;
+    void clear() override;
+
+    bool hasUncommittedChanges() const override { return inTransaction; }
+    bool commit() override;
+    void rollback() override;
+
+    QVector<BorrowRecord> allBorrowRecords() const override;
+    QVector<BorrowRecord> borrowRecordsByBook(const QString &bookId) const override;
+    QVector<BorrowRecord> borrowRecordsByReader(const QString &readerId) const override;
+    QVector<BorrowRecord> recentBorrowRecordsByReader(const QString &readerId,
+                                                      int limit) const override;
+    QVector<BorrowRecord> overdueRecords(const QDate &today) const override;
+    QVector<BorrowRecord> recordsDueBetween(const QDate &first, const QDate &last) const override;
+    void forEachBorrowedBetween(const QDate &first, const QDate &last,
+                                const std::function<bool(const BorrowRecord &)> &visit) const override;
+
+private:
+    struct Statements;
+
+    bool exec(const QString &sql);
+    bool createSchema();
+    bool prepareStatements();
+    void beginWrite();
+    bool run(QSqlQuery &query) const;
+    QVector<BorrowRecord> selectRecords(QSqlQuery &query) const;
+    static BorrowRecord recordFromQuery(const QSqlQuery &query);
+
+    QString connectionName;
+    QString filename;
+    QSqlDatabase db;
+    bool inTransaction;
+    QScopedPointer<Statements> statements;   // 预编译语句，须在关闭连接前销毁
+};
+
+#endif // SQLITESTORAGE_H
@@ -0,0 +1,64 @@
+#ifndef STORAGEBACKEND_H
+#define STORAGEBACKEND_H
+
+#include <QString>
+#include <QDate>
+#include <QVector>
+#include <functional>
+#include "book.h"
+#include "borrowrecord.h"
+#include "librarysnapshot.h"
+#include "reader.h"
+
+// LibraryManager 下的可替换存储后端
+//
+// 默认不使用后端：全部数据在内存中，保存时写文本或二进制文件。
+// 使用后端时，图书、读者、预定和时间设置仍在打开时读入内存供界面使用，
+// 借阅记录只保存在后端中，按图书、读者、到期日的查询由后端完成。
+// 所有修改在同一个事务中累积，commit() 时一次写入，rollback() 或直接
+// 销毁后端则丢弃未提交的修改，与“未保存”的文件语义一致。
+class StorageBackend
+{
+public:
+    virtual ~StorageBackend() {}
+
+    virtual QString fileName() const = 0;
+
+    // 读出图书、读者、预定和时间设置（不含借阅记录）
+    virtual bool loadCatalog(LibrarySnapshot *catalog) = 0;
+    // 用快照替换后端中的全部数据并立即提交
+    virtual bool importSnapshot(const LibrarySnapshot &snapshot) = 0;
+
+    // 修改
+    virtual void saveBook(const Book &book) = 0;
+    virtual void removeBook(const QString &id) = 0;
+    virtual void saveReader(const Reader &reader) = 0;
+    virtual void removeReader(const QString &id) = 0;
+    virtual void addBorrowRecord(const BorrowRecord &record) = 0;
+    virtual bool returnBorrowRecord(const QString &readerId, const QString &bookId,
+                                    const QDate &returnDate) = 0;
+    virtual void addReservation(const QString &readerId, const QString &bookId) = 0;
+    virtual void removeReservation(const QString &readerId, const QString &bookId) = 0;  // 删除最早的一条
+    virtual void saveTimeSettings(bool useCustomTime, const QDate &customDate) = 0;
+    virtual void clear() = 0;
+
+    // 事务
+    virtual bool hasUncommittedChanges() const = 0;
+    virtual bool commit() = 0;
+    virtual void rollback() = 0;
+
+    // 借阅记录查询
+    virtual QVector<BorrowRecord> allBorrowRecords() const = 0;
+    virtual QVector<BorrowRecord> borrowRecordsByBook(const QString &bookId) const = 0;
+    virtual QVector<BorrowRecord> borrowRecordsByReader(const QString &readerId) const = 0;
+    // 读者最近写入的至多 limit 条记录，按写入先后
+    virtual QVector<BorrowRecord> recentBorrowRecordsByReader(const QString &readerId,
+                                                              int limit) const = 0;
+    virtual QVector<BorrowRecord> overdueRecords(const QDate &today) const = 0;
+    virtual QVector<BorrowRecord> recordsDueBetween(const QDate &first, const QDate &last) const = 0;
+    // 按借阅日期顺序逐条读出 [first, last] 内借出的记录，visit 返回 false 时停止
+    virtual void forEachBorrowedBetween(const QDate &first, const QDate &last,
+                                        const std::function<bool(const BorrowRecord &)> &visit) const = 0;
+};
+
+#endif // STORAGEBACKEND_H
@@ -1,32 +1,66 @@
-QT       += core gui
-
-greaterThan(QT_MAJOR_VERSION, 4): QT += widgets
-
-CONFIG += c++17
-
-# You can make your code fail to compile if it uses deprecated APIs.
-# In order to do so, uncomment the following line.
-#DEFINES += QT_DISABLE_DEPRECATED_BEFORE=0x060000    # disables all the APIs deprecated before Qt 6.0.0
-
-SOURCES += \
-    book.cpp \
-    borrowrecord.cpp \
-    librarymanager.cpp \
-    main.cpp \
-    mainwindow.cpp \
-    reader.cpp
-
-HEADERS += \
-    book.h \
-    borrowrecord.h \
-    librarymanager.h \
-    mainwindow.h \
-    reader.h
-
-FORMS += \
-    mainwindow.ui
-
-# Default rules for deployment.
-qnx: target.path = /tmp/$${TARGET}/bin
-else: unix:!android: target.path = /opt/$${TARGET}/bin
-!isEmpty(target.path): INSTALLS += target
+QT       += core gui concurrent sql
+
+greaterThan(QT_MAJOR_VERSION, 4): QT += widgets
+
+CONFIG += c++17
+
+# You can make your code fail to compile if it uses deprecated APIs.
+# In order to do so, uncomment the following line.
+#DEFINES += QT_DISABLE_DEPRECATED_BEFORE=0x060000    # disables all the APIs deprecated before Qt 6.0.0
+
+SOURCES += \
+    binaryformat.cpp \
+    book.cpp \
+    borrowrecord.cpp \
+    coborrowindex.cpp \
+    historysegment.cpp \
+    idpool.cpp \
+    libraryjournal.cpp \
+    librarymanager.cpp \
+    librarysnapshot.cpp \
+    main.cpp \
+    mainwindow.cpp \
+    ngramindex.cpp \
+    pinyin.cpp \
+    pinyinindex.cpp \
+    popularitytracker.cpp \
+    prefixindex.cpp \
+    reader.cpp \
+    recordparser.cpp \
+    reservationqueue.cpp \
+    sectionscanner.cpp \
+    slotbitmap.cpp \
+    sqlitestorage.cpp
+
+HEADERS += \
+    binaryformat.h \
+    book.h \
+    borrowrecord.h \
+    coborrowindex.h \
+    historysegment.h \
+    idpool.h \
+    libraryjournal.h \
+    librarymanager.h \
+    librarysnapshot.h \
+    mainwindow.h \
+    ngramindex.h \
+    pinyin.h \
+    pinyinindex.h \
+    popularitytracker.h \
+    prefixindex.h \
+    reader.h \
+    recordparser.h \
+    reservationqueue.h \
+    sectionscanner.h \
+    slotbitmap.h \
+    slottable.h \
+    sqlitestorage.h \
+    storagebackend.h
+
+FORMS += \
+    mainwindow.ui
+
+# Default rules for deployment.
+qnx: target.path = /tmp/$${TARGET}/bin
+else: unix:!android: target.path = /opt/$${TARGET}/bin
+!isEmpty(target.path): INSTALLS += target
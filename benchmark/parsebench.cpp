@@ -0,0 +1,118 @@
+#include <QByteArray>
+#include <QCoreApplication>
+#include <QDate>
+#include <QElapsedTimer>
+#include <QStringList>
+#include <QTextStream>
+#include <QVector>
+#include "book.h"
+#include "borrowrecord.h"
+#include "reader.h"
+
+// 生成 count 行与 .lib 文件格式相同的记录
+static QVector<QByteArray> makeLines(const char *kind, int count)
+{
+    QVector<QByteArray> lines;
+    lines.reserve(count);
+    QDate base(2020, 1, 1);
+    for (int i = 0; i < count; ++i) {
+        QString line;
+        QString day = base.addDays(i % 1500).toString("yyyy-MM-dd");
+        QString due = base.addDays(i % 1500 + 30).toString("yyyy-MM-dd");
+        if (qstrcmp(kind, "book") == 0) {
+            line = QString("B%1,数据结构与算法分析 第%2版,作者%3,%4,%5,%6,0")
+                       .arg(i).arg(i % 9 + 1).arg(i % 500).arg(i % 7).arg(i % 5 + 1).arg(i % 3);
+        } else if (qstrcmp(kind, "reader") == 0) {
+            line = QString("R%1,读者%2,计算机学院,138%3,%4,1")
+                       .arg(i).arg(i).arg(i, 8, 10, QChar('0')).arg(day);
+        } else {
+            line = QString("R%1,B%2,%3,%4,%5")
+                       .arg(i % 5000).arg(i % 20000).arg(day).arg(due)
+                       .arg(i % 4 ? due : QString());
+        }
+        lines.append(line.toUtf8());
+    }
+    return lines;
+}
+
+// 旧实现：每行生成 QString 和 QStringList，日期用格式串解析
+static void oldParse(const QByteArray &utf8, Book &book)
+{
+    QStringList fields = QString::fromUtf8(utf8).split(",");
+    if (fields.size() >= 7) {
+        book.setId(fields[0]);
+        book.setTitle(fields[1]);
+        book.setAuthor(fields[2]);
+        book.setCategory(static_cast<BookCategory>(fields[3].toInt()));
+        book.setTotalCopies(fields[4].toInt());
+        book.setAvailableCopies(fields[5].toInt());
+        book.setStatus(static_cast<BookStatus>(fields[6].toInt()));
+    }
+}
+
+static void oldParse(const QByteArray &utf8, Reader &reader)
+{
+    QStringList fields = QString::fromUtf8(utf8).split(",");
+    if (fields.size() >= 6) {
+        reader.setId(fields[0]);
+        reader.setName(fields[1]);
+        reader.setDept(fields[2]);
+        reader.setPhone(fields[3]);
+        reader.setRegisterDate(QDate::fromString(fields[4], "yyyy-MM-dd"));
+        reader.setValid(fields[5] == "1");
+    }
+}
+
+static void oldParse(const QByteArray &utf8, BorrowRecord &record)
+{
+    QStringList fields = QString::fromUtf8(utf8).split(",");
+    if (fields.size() >= 5) {
+        record = BorrowRecord(fields[0], fields[1],
+                              QDate::fromString(fields[2], "yyyy-MM-dd"),
+                              QDate::fromString(fields[3], "yyyy-MM-dd"),
+                              QDate::fromString(fields[4], "yyyy-MM-dd"));
+    }
+}
+
+// 分别用两种方式解析同一批行，输出每秒解析的记录数
+template <typename T>
+static void run(QTextStream &out, const char *kind, int count)
+{
+    QVector<QByteArray> lines = makeLines(kind, count);
+    QVector<T> items(count);
+    QElapsedTimer timer;
+
+    timer.start();
+    for (int i = 0; i < count; ++i) {
+        oldParse(lines[i], items[i]);
+    }
+    qint64 oldNs = qMax<qint64>(1, timer.nsecsElapsed());
+
+    timer.restart();
+    for (int i = 0; i < count; ++i) {
+        items[i].loadFromLine(lines[i].constData(), lines[i].size());
+    }
+    qint64 newNs = qMax<qint64>(1, timer.nsecsElapsed());
+
+    out << kind << "\t"
+        << "split: " << qint64(count * 1e9 / oldNs) << " 条/秒\t"
+        << "RecordParser: " << qint64(count * 1e9 / newNs) << " 条/秒\t"
+        << QString::number(double(oldNs) / newNs, 'f', 1) << "x\n";
+    out.flush();
+}
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+    int count = (argc > 1) ? QByteArray(argv[1]).toInt() : 1000000;
+    if (count <= 0) {
+        count = 1000000;
+    }
+
+    QTextStream out(stdout);
+    out << "每种记录 " << count << " 行\n";
+    run<Book>(out, "book", count);
+    run<Reader>(out, "reader", count);
+    run<BorrowRecord>(out, "borrow", count);
+    return 0;
+}
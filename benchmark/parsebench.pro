@@ -0,0 +1,17 @@
+# 记录行解析的基准测试：比较逐行 split 的旧解析方式与 RecordParser
+# 用法：qmake && make && ./parsebench [每种记录的行数]
+
+QT       = core
+CONFIG  += console c++17
+CONFIG  -= app_bundle
+
+INCLUDEPATH += ../Header
+VPATH       += ../source
+
+SOURCES += \
+    parsebench.cpp \
+    book.cpp \
+    borrowrecord.cpp \
+    idpool.cpp \
+    reader.cpp \
+    recordparser.cpp
@@ -0,0 +1,224 @@
+#include "binaryformat.h"
+#include <QtEndian>
+#include <cstring>
+
+namespace BinaryFormat {
+
+namespace {
+
+const int HeaderSize = 16;          // 魔数 + 版本号 + 段数量
+const int DirectoryEntrySize = 24;  // 段类型 + 保留 + 偏移 + 长度
+
+} // namespace
+
+void appendU32(QByteArray &buffer, quint32 value)
+{
+    uchar bytes[4];
+    qToLittleEndian<quint32>(value, bytes);
+    buffer.append(reinterpret_cast<const char *>(bytes), 4);
+}
+
+void appendU64(QByteArray &buffer, quint64 value)
+{
+    uchar bytes[8];
+    qToLittleEndian<quint64>(value, bytes);
+    buffer.append(reinterpret_cast<const char *>(bytes), 8);
+}
+
+qint32 dateToDay(const QDate &date)
+{
+    return date.isValid() ? static_cast<qint32>(date.toJulianDay()) : NullDay;
+}
+
+QDate dayToDate(qint32 day)
+{
+    return (day == NullDay) ? QDate() : QDate::fromJulianDay(day);
+}
+
+bool hasMagic(const QByteArray &head)
+{
+    return head.size() >= static_cast<int>(sizeof(Magic)) &&
+           std::memcmp(head.constData(), Magic, sizeof(Magic)) == 0;
+}
+
+quint8 readU8(const uchar *p)
+{
+    return *p;
+}
+
+quint32 readU32(const uchar *p)
+{
+    return qFromLittleEndian<quint32>(p);
+}
+
+qint32 readI32(const uchar *p)
+{
+    return qFromLittleEndian<qint32>(p);
+}
+
+// ============== Writer ==============
+
+quint32 Writer::addString(const QString &str)
+{
+    auto it = stringIndex.constFind(str);
+    if (it != stringIndex.constEnd()) {
+        return it.value();
+    }
+
+    quint32 index = static_cast<quint32>(strings.size());
+    strings.append(str);
+    stringIndex.insert(str, index);
+    return index;
+}
+
+void Writer::beginSection(SectionType type)
+{
+    sections.append(qMakePair(type, QByteArray()));
+}
+
+void Writer::writeU8(quint8 value)
+{
+    sections.last().second.append(static_cast<char>(value));
+}
+
+void Writer::writeU32(quint32 value)
+{
+    appendU32(sections.last().second, value);
+}
+
+void Writer::writeI32(qint32 value)
+{
+    appendU32(sections.last().second, static_cast<quint32>(value));
+}
+
+void Writer::alignSection()
+{
+    QByteArray &buffer = sections.last().second;
+    while (buffer.size() % 4 != 0) {
+        buffer.append('\0');
+    }
+}
+
+QByteArray Writer::finish() const
+{
+    // 字符串段放在最前面，加载时先解码字符串表
+    QByteArray stringData;
+    appendU32(stringData, static_cast<quint32>(strings.size()));
+    for (const QString &str : strings) {
+        QByteArray utf8 = str.toUtf8();
+        appendU32(stringData, static_cast<quint32>(utf8.size()));
+        stringData.append(utf8);
+    }
+    while (stringData.size() % 4 != 0) {
+        stringData.append('\0');
+    }
+
+    QVector<QPair<SectionType, QByteArray>> all;
+    all.append(qMakePair(StringSection, stringData));
+    all.append(sections);
+
+    QByteArray out;
+    out.append(Magic, sizeof(Magic));
+    appendU32(out, Version);
+    appendU32(out, static_cast<quint32>(all.size()));
+
+    quint64 offset = HeaderSize + DirectoryEntrySize * all.size();
+    for (const auto &section : all) {
+        appendU32(out, section.first);
+        appendU32(out, 0);
+        appendU64(out, offset);
+        appendU64(out, static_cast<quint64>(section.second.size()));
+        offset += section.second.size();
+    }
+
+    for (const auto &section : all) {
+        out.append(section.second);
+    }
+    return out;
+}
+
+// ============== Reader ==============
+
+Reader::Reader(const uchar *data, qint64 size) :
+    data(data),
+    size(size),
+    valid(false),
+    fileVersion(0)
+{
+    if (!data || size < HeaderSize ||
+        std::memcmp(data, Magic, sizeof(Magic)) != 0) {
+        return;
+    }
+
+    fileVersion = readU32(data + 8);
+    if (fileVersion == 0 || fileVersion > Version) {
+        return;
+    }
+
+    quint32 sectionCount = readU32(data + 12);
+    if (HeaderSize + static_cast<qint64>(sectionCount) * DirectoryEntrySize > size) {
+        return;
+    }
+
+    for (quint32 i = 0; i < sectionCount; ++i) {
+        const uchar *entry = data + HeaderSize + i * DirectoryEntrySize;
+        quint32 type = readU32(entry);
+        quint64 offset = qFromLittleEndian<quint64>(entry + 8);
+        quint64 length = qFromLittleEndian<quint64>(entry + 16);
+        if (offset > static_cast<quint64>(size) ||
+            length > static_cast<quint64>(size) - offset) {
+            return;
+        }
+        directory.insert(type, qMakePair(static_cast<qint64>(offset),
+                                         static_cast<qint64>(length)));
+    }
+
+    valid = loadStrings();
+}
+
+const uchar *Reader::section(SectionType type, qint64 *sectionSize) const
+{
+    auto it = directory.constFind(type);
+    if (it == directory.constEnd()) {
+        return nullptr;
+    }
+    if (sectionSize) {
+        *sectionSize = it.value().second;
+    }
+    return data + it.value().first;
+}
+
+QString Reader::string(quint32 index) const
+{
+    return (index < static_cast<quint32>(strings.size())) ? strings[index] : QString();
+}
+
+bool Reader::loadStrings()
+{
+    qint64 length = 0;
+    const uchar *p = section(StringSection, &length);
+    if (!p || length < 4) {
+        return false;
+    }
+
+    const uchar *end = p + length;
+    quint32 count = readU32(p);
+    p += 4;
+
+    strings.reserve(static_cast<int>(qMin<qint64>(count, length / 4)));
+    for (quint32 i = 0; i < count; ++i) {
+        if (end - p < 4) {
+            return false;
+        }
+        quint32 len = readU32(p);
+        p += 4;
+        if (static_cast<quint64>(end - p) < len) {
+            return false;
+        }
+        strings.append(QString::fromUtf8(reinterpret_cast<const char *>(p), len));
+        p += len;
+    }
+    return true;
+}
+
+} // namespace BinaryFormat
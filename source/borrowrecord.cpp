@@ -1,42 +1,106 @@
-#include "borrowrecord.h"
-
-BorrowRecord::BorrowRecord() :
-    readerId(""),
-    bookId(""),
-    borrowDate(QDate::currentDate()),
-    dueDate(borrowDate.addDays(30))
-{
-}
-
-BorrowRecord::BorrowRecord(QString readerId, QString bookId,
-                           QDate borrowDate, QDate dueDate, QDate returnDate) :
-    readerId(readerId),
-    bookId(bookId),
-    borrowDate(borrowDate),
-    dueDate(dueDate),
-    returnDate(returnDate)
-{
-}
-
-void BorrowRecord::saveToStream(QTextStream &out) const
-{
-    out << readerId << ","
-        << bookId << ","
-        << borrowDate.toString("yyyy-MM-dd") << ","
-        << dueDate.toString("yyyy-MM-dd") << ","
-        << returnDate.toString("yyyy-MM-dd") << "\n";
-}
-
-void BorrowRecord::loadFromStream(QTextStream &in)
-{
-    QString line = in.readLine();
-    QStringList fields = line.split(",");
-
-    if (fields.size() >= 5) {
-        readerId = fields[0];
-        bookId = fields[1];
-        borrowDate = QDate::fromString(fields[2], "yyyy-MM-dd");
-        dueDate = QDate::fromString(fields[3], "yyyy-MM-dd");
-        returnDate = QDate::fromString(fields[4], "yyyy-MM-dd");
-    }
-}
+#include "borrowrecord.h"
+#include "recordparser.h"
+
+static_assert(sizeof(BorrowRecord) == 16, "BorrowRecord 应为 16 字节");
+
+BorrowRecord::BorrowRecord() :
+    reader(IdPool::EmptyHandle),
+    book(IdPool::EmptyHandle),
+    borrowDay(dayOf(QDate::currentDate())),
+    dueOffset(30),
+    returnOffset(NullOffset)
+{
+}
+
+// 成员按声明顺序初始化，计算偏移时 borrowDay 已经赋值
+BorrowRecord::BorrowRecord(QString readerId, QString bookId,
+                           QDate borrowDate, QDate dueDate, QDate returnDate) :
+    reader(IdPool::intern(readerId)),
+    book(IdPool::intern(bookId)),
+    borrowDay(dayOf(borrowDate)),
+    dueOffset(offsetOf(dueDate)),
+    returnOffset(offsetOf(returnDate))
+{
+}
+
+BorrowRecord::BorrowRecord(IdPool::Handle reader, IdPool::Handle book,
+                           QDate borrowDate, QDate dueDate, QDate returnDate) :
+    reader(reader),
+    book(book),
+    borrowDay(dayOf(borrowDate)),
+    dueOffset(offsetOf(dueDate)),
+    returnOffset(offsetOf(returnDate))
+{
+}
+
+// 借阅日期改变时应还、归还日期保持不变，偏移重新计算
+void BorrowRecord::setBorrowDate(QDate date)
+{
+    QDate due = getDueDate();
+    QDate returned = getReturnDate();
+    borrowDay = dayOf(date);
+    dueOffset = offsetOf(due);
+    returnOffset = offsetOf(returned);
+}
+
+qint32 BorrowRecord::dayOf(const QDate &date)
+{
+    return date.isValid() ? static_cast<qint32>(date.toJulianDay()) : NullDay;
+}
+
+qint16 BorrowRecord::offsetOf(const QDate &date) const
+{
+    if (!date.isValid() || borrowDay == NullDay) {
+        return NullOffset;
+    }
+    qint64 offset = date.toJulianDay() - borrowDay;
+    return static_cast<qint16>(qBound<qint64>(NullOffset + 1, offset, 32767));
+}
+
+QDate BorrowRecord::dateAt(qint16 offset) const
+{
+    if (offset == NullOffset || borrowDay == NullDay) {
+        return QDate();
+    }
+    return QDate::fromJulianDay(static_cast<qint64>(borrowDay) + offset);
+}
+
+void BorrowRecord::saveToStream(QTextStream &out) const
+{
+    out << IdPool::string(reader) << ","
+        << IdPool::string(book) << ","
+        << getBorrowDate().toString("yyyy-MM-dd") << ","
+        << getDueDate().toString("yyyy-MM-dd") << ","
+        << getReturnDate().toString("yyyy-MM-dd") << "\n";
+}
+
+void BorrowRecord::loadFromStream(QTextStream &in)
+{
+    QByteArray line = in.readLine().toUtf8();
+    loadFromLine(line.constData(), line.size());
+}
+
+void BorrowRecord::loadFromLine(const char *line, int length)
+{
+    RecordParser::Field readerId;
+    RecordParser::Field bookId;
+    if (parseLine(line, length, &readerId, &bookId)) {
+        reader = IdPool::intern(RecordParser::toString(readerId));
+        book = IdPool::intern(RecordParser::toString(bookId));
+    }
+}
+
+bool BorrowRecord::parseLine(const char *line, int length,
+                             RecordParser::Field *readerId, RecordParser::Field *bookId)
+{
+    RecordParser::Field fields[5];
+    if (RecordParser::split(line, length, fields, 5) < 5) {
+        return false;
+    }
+    *readerId = fields[0];
+    *bookId = fields[1];
+    borrowDay = dayOf(RecordParser::toDate(fields[2]));
+    dueOffset = offsetOf(RecordParser::toDate(fields[3]));
+    returnOffset = offsetOf(RecordParser::toDate(fields[4]));
+    return true;
+}
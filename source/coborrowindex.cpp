@@ -0,0 +1,129 @@
+#include "coborrowindex.h"
+#include <QtConcurrent>
+#include <algorithm>
+#include <numeric>
+
+void CoBorrowIndex::clear()
+{
+    lists.clear();
+    histories.clear();
+}
+
+void CoBorrowIndex::remember(IdPool::Handle reader, IdPool::Handle book)
+{
+    QVector<IdPool::Handle> &history = histories[reader];
+    history.removeOne(book);   // 重复借阅只移到最后
+    history.append(book);
+    if (history.size() > MaxHistory) {
+        history.removeFirst();
+    }
+}
+
+// 先生成“图书 -> 借过它的读者”的倒排表，再按图书并行统计，每个任务只写自己那本书的结果
+void CoBorrowIndex::recount()
+{
+    QVector<const QVector<IdPool::Handle> *> readerBooks;
+    readerBooks.reserve(histories.size());
+    for (auto it = histories.constBegin(); it != histories.constEnd(); ++it) {
+        readerBooks.append(&it.value());
+    }
+
+    QHash<IdPool::Handle, QVector<quint32>> readersOf;
+    for (int r = 0; r < readerBooks.size(); ++r) {
+        for (IdPool::Handle book : *readerBooks[r]) {
+            readersOf[book].append(static_cast<quint32>(r));
+        }
+    }
+
+    // 各任务只读共享的倒排表，结果按图书顺序放在 results 中，最后统一写入散列表
+    const QVector<IdPool::Handle> books = readersOf.keys();
+    QVector<QVector<Neighbor>> results(books.size());
+    QVector<Neighbor> *out = results.data();
+    QVector<int> order(books.size());
+    std::iota(order.begin(), order.end(), 0);
+
+    QtConcurrent::blockingMap(order, [&](int &i) {
+        IdPool::Handle book = books.at(i);
+        QHash<IdPool::Handle, int> counts;
+        for (quint32 r : readersOf.constFind(book).value()) {
+            for (IdPool::Handle other : *readerBooks.at(r)) {
+                if (other != book) {
+                    counts[other]++;
+                }
+            }
+        }
+
+        QVector<Neighbor> all;
+        all.reserve(counts.size());
+        for (auto it = counts.constBegin(); it != counts.constEnd(); ++it) {
+            all.append(Neighbor{it.key(), it.value()});
+        }
+        auto byCount = [](const Neighbor &a, const Neighbor &b) {
+            return a.count != b.count ? a.count > b.count : a.book < b.book;
+        };
+        int keep = qMin(static_cast<int>(all.size()), MaxNeighbors);
+        std::partial_sort(all.begin(), all.begin() + keep, all.end(), byCount);
+        all.resize(keep);
+        all.squeeze();
+        out[i] = all;
+    });
+
+    lists.clear();
+    lists.reserve(books.size());
+    for (int i = 0; i < books.size(); ++i) {
+        if (!results.at(i).isEmpty()) {
+            lists.insert(books.at(i), results.at(i));
+        }
+    }
+}
+
+void CoBorrowIndex::addLoan(IdPool::Handle reader, IdPool::Handle book)
+{
+    const QVector<IdPool::Handle> history = histories.value(reader);
+    if (!history.contains(book)) {
+        for (IdPool::Handle other : history) {
+            bump(book, other);
+            bump(other, book);
+        }
+    }
+    remember(reader, book);
+}
+
+QVector<QPair<IdPool::Handle, int>> CoBorrowIndex::neighbors(IdPool::Handle book, int k) const
+{
+    QVector<QPair<IdPool::Handle, int>> result;
+    auto it = lists.constFind(book);
+    if (it == lists.constEnd()) {
+        return result;
+    }
+
+    const QVector<Neighbor> &list = it.value();
+    for (int i = 0; i < list.size() && result.size() < k; ++i) {
+        result.append(qMakePair(list[i].book, list[i].count));
+    }
+    return result;
+}
+
+// 共现次数加一后向前冒泡，保持列表有序
+void CoBorrowIndex::bump(IdPool::Handle book, IdPool::Handle other)
+{
+    QVector<Neighbor> &list = lists[book];
+    int i = 0;
+    while (i < list.size() && list[i].book != other) {
+        ++i;
+    }
+
+    if (i < list.size()) {
+        list[i].count++;
+    } else if (list.size() < MaxNeighbors) {
+        list.append(Neighbor{other, 1});
+    } else {
+        i = list.size() - 1;
+        list[i] = Neighbor{other, list[i].count + 1};
+    }
+
+    while (i > 0 && list[i - 1].count < list[i].count) {
+        std::swap(list[i - 1], list[i]);
+        --i;
+    }
+}
@@ -0,0 +1,220 @@
+#include "historysegment.h"
+#include <QDebug>
+
+HistorySegment::HistorySegment(const QString &filename, const QVector<QString> &strings) :
+    file(filename),
+    mapped(nullptr),
+    mappedLength(0),
+    strings(strings),
+    count(0),
+    keyCount(0),
+    base(nullptr),
+    readerIds(nullptr),
+    bookIds(nullptr),
+    borrowDays(nullptr),
+    dueDays(nullptr),
+    returnDays(nullptr),
+    bookStart(nullptr),
+    bookPostings(nullptr),
+    readerStart(nullptr),
+    readerPostings(nullptr)
+{
+}
+
+HistorySegment::~HistorySegment()
+{
+    if (mapped) {
+        file.unmap(mapped);
+    }
+    file.close();
+}
+
+QSharedPointer<HistorySegment> HistorySegment::open(const QString &filename,
+                                                    qint64 offset, qint64 length,
+                                                    const QVector<QString> &strings)
+{
+    QSharedPointer<HistorySegment> segment(new HistorySegment(filename, strings));
+    if (!segment->map(offset, length)) {
+        qDebug() << "无法映射借阅历史段：" << filename;
+        return QSharedPointer<HistorySegment>();
+    }
+    return segment;
+}
+
+bool HistorySegment::map(qint64 offset, qint64 length)
+{
+    if (length < 8 || !file.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+
+    mapped = file.map(offset, length);
+    if (!mapped) {
+        return false;
+    }
+
+    qint64 n = BinaryFormat::readU32(mapped);
+    qint64 k = BinaryFormat::readU32(mapped + 4);
+    if (k > strings.size() || 8 + n * 20 + 2 * (4 * (k + 1) + 4 * n) > length) {
+        return false;
+    }
+
+    mappedLength = length;
+    count = static_cast<int>(n);
+    keyCount = static_cast<quint32>(k);
+    setBase(mapped);
+
+    // 字符串表里还有书名、作者、姓名等，只把历史记录引用到的编号（分组非空的
+    // 下标）放入驻留池；只读取两个分组起点数组，与历史记录数无关
+    auto hasRecords = [](const uchar *start, quint32 i) {
+        return BinaryFormat::readU32(start + 4 * (i + 1)) > BinaryFormat::readU32(start + 4 * i);
+    };
+    handles.fill(IdPool::InvalidHandle, keyCount);
+    for (quint32 i = 0; i < keyCount; ++i) {
+        if (hasRecords(bookStart, i) || hasRecords(readerStart, i)) {
+            handles[i] = IdPool::intern(strings[i]);
+            keyIndex.insert(handles[i], i);
+        }
+    }
+    return true;
+}
+
+void HistorySegment::setBase(const uchar *data)
+{
+    qint64 n = count;
+    qint64 k = keyCount;
+    base = data;
+    readerIds = base + 8;
+    bookIds = readerIds + 4 * n;
+    borrowDays = bookIds + 4 * n;
+    dueDays = borrowDays + 4 * n;
+    returnDays = dueDays + 4 * n;
+    bookStart = returnDays + 4 * n;
+    bookPostings = bookStart + 4 * (k + 1);
+    readerStart = bookPostings + 4 * n;
+    readerPostings = readerStart + 4 * (k + 1);
+}
+
+// 把段内容复制到内存并关闭文件，之后的查询不再访问磁盘
+void HistorySegment::detach()
+{
+    if (!mapped) {
+        return;
+    }
+
+    buffer = QByteArray(reinterpret_cast<const char *>(mapped), mappedLength);
+    setBase(reinterpret_cast<const uchar *>(buffer.constData()));
+    file.unmap(mapped);
+    mapped = nullptr;
+    file.close();
+}
+
+BorrowRecord HistorySegment::recordAt(int index) const
+{
+    return BorrowRecord(handles.value(BinaryFormat::readU32(readerIds + 4 * index)),
+                        handles.value(BinaryFormat::readU32(bookIds + 4 * index)),
+                        BinaryFormat::dateAt(borrowDays, index),
+                        BinaryFormat::dateAt(dueDays, index),
+                        BinaryFormat::dateAt(returnDays, index));
+}
+
+// 记录按借阅日期排序，二分查找
+int HistorySegment::lowerBound(const QDate &borrowDate) const
+{
+    int low = 0;
+    int high = count;
+    while (low < high) {
+        int mid = low + (high - low) / 2;
+        if (borrowDateAt(mid) < borrowDate) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+QVector<BorrowRecord> HistorySegment::recordsByBook(const QString &bookId) const
+{
+    return postingRecords(bookStart, bookPostings, IdPool::find(bookId));
+}
+
+QVector<BorrowRecord> HistorySegment::recordsByReader(const QString &readerId) const
+{
+    return postingRecords(readerStart, readerPostings, IdPool::find(readerId));
+}
+
+// 同一读者的记录下标升序排列，也就是按借阅日期排列，最近的在分组末尾
+QVector<BorrowRecord> HistorySegment::recentRecordsByReader(IdPool::Handle reader, int limit) const
+{
+    return postingRecords(readerStart, readerPostings, reader, limit);
+}
+
+QVector<BorrowRecord> HistorySegment::postingRecords(const uchar *start, const uchar *postings,
+                                                     IdPool::Handle key, int limit) const
+{
+    QVector<BorrowRecord> records;
+
+    auto it = keyIndex.constFind(key);
+    if (it == keyIndex.constEnd()) {
+        return records;
+    }
+
+    quint32 begin = BinaryFormat::readU32(start + 4 * it.value());
+    quint32 end = BinaryFormat::readU32(start + 4 * (it.value() + 1));
+    if (begin > end || end > static_cast<quint32>(count)) {
+        return records;
+    }
+    if (limit >= 0 && end - begin > static_cast<quint32>(limit)) {
+        begin = end - static_cast<quint32>(limit);
+    }
+
+    records.reserve(end - begin);
+    for (quint32 i = begin; i < end; ++i) {
+        quint32 index = BinaryFormat::readU32(postings + 4 * i);
+        if (index < static_cast<quint32>(count)) {
+            records.append(recordAt(static_cast<int>(index)));
+        }
+    }
+    return records;
+}
+
+void HistorySegment::write(BinaryFormat::Writer &writer, const QVector<BorrowRecord> &records)
+{
+    int n = records.size();
+    QVector<quint32> readerIndex(n);
+    QVector<quint32> bookIndex(n);
+    for (int i = 0; i < n; ++i) {
+        readerIndex[i] = writer.addString(records[i].getReaderId());
+        bookIndex[i] = writer.addString(records[i].getBookId());
+    }
+    quint32 keyCount = static_cast<quint32>(writer.stringCount());
+
+    writer.beginSection(BinaryFormat::HistorySection);
+    writer.writeU32(n);
+    writer.writeU32(keyCount);
+    for (int i = 0; i < n; ++i) writer.writeU32(readerIndex[i]);
+    for (int i = 0; i < n; ++i) writer.writeU32(bookIndex[i]);
+    for (const BorrowRecord &record : records) writer.writeDate(record.getBorrowDate());
+    for (const BorrowRecord &record : records) writer.writeDate(record.getDueDate());
+    for (const BorrowRecord &record : records) writer.writeDate(record.getReturnDate());
+
+    // 计数排序生成压缩行格式的分组索引，组内保持借阅日期顺序
+    for (const QVector<quint32> *keys : {&bookIndex, &readerIndex}) {
+        QVector<quint32> start(keyCount + 1, 0);
+        for (int i = 0; i < n; ++i) {
+            start[(*keys)[i] + 1]++;
+        }
+        for (quint32 k = 0; k < keyCount; ++k) {
+            start[k + 1] += start[k];
+        }
+
+        QVector<quint32> postings(n);
+        QVector<quint32> cursor = start;
+        for (int i = 0; i < n; ++i) {
+            postings[cursor[(*keys)[i]]++] = static_cast<quint32>(i);
+        }
+
+        for (quint32 value : start) writer.writeU32(value);
+        for (quint32 value : postings) writer.writeU32(value);
+    }
+}
@@ -0,0 +1,101 @@
+#include "idpool.h"
+#include <QAtomicInteger>
+#include <QHash>
+#include <QReadWriteLock>
+
+namespace IdPool {
+
+namespace {
+
+// 每块 16384 个字符串，最多 4096 块（约 6700 万个编号），块在用到时才分配
+const int ChunkBits = 14;
+const quint32 ChunkSize = 1u << ChunkBits;
+const quint32 MaxChunks = 4096;
+
+struct Pool
+{
+    QReadWriteLock lock;
+    QHash<QString, Handle> handles;         // 字符串编号 -> 句柄
+    QString *chunks[MaxChunks] = {};        // 句柄 -> 字符串编号，分块保存
+    QAtomicInteger<quint32> count;          // 已分配的句柄数，写入字符串后才增加
+
+    Pool() : count(0)
+    {
+        add(QString(""));   // EmptyHandle
+    }
+
+    ~Pool()
+    {
+        for (QString *chunk : chunks) {
+            delete[] chunk;
+        }
+    }
+
+    // 调用方持有写锁
+    Handle add(const QString &id)
+    {
+        Handle handle = count.loadRelaxed();
+        quint32 chunk = handle >> ChunkBits;
+        if (chunk >= MaxChunks) {
+            qFatal("编号驻留池已满");
+        }
+        if (!chunks[chunk]) {
+            chunks[chunk] = new QString[ChunkSize];
+        }
+        chunks[chunk][handle & (ChunkSize - 1)] = id;
+        handles.insert(id, handle);
+        count.storeRelease(handle + 1);
+        return handle;
+    }
+};
+
+Pool &pool()
+{
+    static Pool instance;
+    return instance;
+}
+
+} // namespace
+
+Handle intern(const QString &id)
+{
+    Pool &p = pool();
+    {
+        QReadLocker locker(&p.lock);
+        auto it = p.handles.constFind(id);
+        if (it != p.handles.constEnd()) {
+            return it.value();
+        }
+    }
+
+    // 加写锁前可能已有其他线程分配了同一编号，再查一次
+    QWriteLocker locker(&p.lock);
+    auto it = p.handles.constFind(id);
+    if (it != p.handles.constEnd()) {
+        return it.value();
+    }
+    return p.add(id);
+}
+
+Handle find(const QString &id)
+{
+    Pool &p = pool();
+    QReadLocker locker(&p.lock);
+    return p.handles.value(id, InvalidHandle);
+}
+
+QString string(Handle handle)
+{
+    Pool &p = pool();
+    if (handle >= p.count.loadAcquire()) {
+        return QString();
+    }
+    return p.chunks[handle >> ChunkBits][handle & (ChunkSize - 1)];
+}
+
+quint32 size()
+{
+    return pool().count.loadAcquire();
+}
+
+} // namespace IdPool
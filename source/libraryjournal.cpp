@@ -0,0 +1,255 @@
+#include "libraryjournal.h"
+#include "binaryformat.h"
+#include <QFile>
+#include <QFileInfo>
+#include <QDebug>
+
+QString LibraryJournal::journalPath(const QString &dataFile)
+{
+    return dataFile + ".journal";
+}
+
+void LibraryJournal::append(Operation op, const QStringList &fields)
+{
+    QByteArray payload;
+    payload.append(static_cast<char>(op));
+    payload.append(static_cast<char>(fields.size()));
+    for (const QString &field : fields) {
+        QByteArray utf8 = field.toUtf8();
+        BinaryFormat::appendU32(payload, static_cast<quint32>(utf8.size()));
+        payload.append(utf8);
+    }
+
+    BinaryFormat::appendU32(pending, static_cast<quint32>(payload.size()));
+    BinaryFormat::appendU32(pending, qChecksum(payload));
+    pending.append(payload);
+    pendingEntries++;
+}
+
+void LibraryJournal::discardPending()
+{
+    pending.clear();
+    pendingEntries = 0;
+}
+
+QByteArray LibraryJournal::takePending(int *entryCount)
+{
+    QByteArray data = pending;
+    if (entryCount) {
+        *entryCount = pendingEntries;
+    }
+    discardPending();
+    return data;
+}
+
+void LibraryJournal::restorePending(const QByteArray &data, int entryCount)
+{
+    pending.prepend(data);
+    pendingEntries += entryCount;
+}
+
+bool LibraryJournal::flush(const QString &dataFile)
+{
+    if (!hasPending()) {
+        return true;
+    }
+
+    QFile file(journalPath(dataFile));
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Append)) {
+        qDebug() << "无法打开日志文件：" << file.fileName();
+        return false;
+    }
+
+    if (file.write(pending) != pending.size() || !file.flush()) {
+        file.close();
+        qDebug() << "写入日志文件时发生错误：" << file.fileName();
+        return false;
+    }
+
+    file.close();
+    qDebug() << "已追加" << pendingEntries << "条变更到日志：" << file.fileName();
+    discardPending();
+    return true;
+}
+
+bool LibraryJournal::needsCheckpoint(const QString &dataFile) const
+{
+    QFileInfo dataInfo(dataFile);
+    if (!dataInfo.exists()) {
+        return true;
+    }
+
+    QFileInfo journalInfo(journalPath(dataFile));
+    qint64 journalSize = (journalInfo.exists() ? journalInfo.size() : 0) + pending.size();
+    return journalSize > qMax(dataInfo.size() / CheckpointRatio, CheckpointMinBytes);
+}
+
+bool LibraryJournal::removeJournal(const QString &dataFile)
+{
+    QString path = journalPath(dataFile);
+    return !QFile::exists(path) || QFile::remove(path);
+}
+
+QVector<LibraryJournal::Entry> LibraryJournal::readAll(const QString &dataFile, qint64 *validLength)
+{
+    QVector<Entry> entries;
+    if (validLength) {
+        *validLength = 0;
+    }
+
+    QFile file(journalPath(dataFile));
+    if (!file.open(QIODevice::ReadOnly)) {
+        // 日志存在却读不出来时不能当作空日志截断
+        if (validLength && file.exists()) {
+            *validLength = -1;
+        }
+        return entries;
+    }
+
+    QByteArray data = file.readAll();
+    file.close();
+
+    const uchar *p = reinterpret_cast<const uchar *>(data.constData());
+    const uchar *end = p + data.size();
+
+    while (end - p >= 8) {
+        quint32 length = BinaryFormat::readU32(p);
+        quint32 checksum = BinaryFormat::readU32(p + 4);
+        if (static_cast<quint64>(end - p - 8) < length || length < 2) {
+            break;  // 最后一条记录没有写完
+        }
+
+        QByteArrayView payload(reinterpret_cast<const char *>(p + 8), length);
+        if (qChecksum(payload) != checksum) {
+            qDebug() << "日志记录校验失败，停止回放：" << file.fileName();
+            break;
+        }
+
+        const uchar *q = p + 8;
+        const uchar *payloadEnd = q + length;
+        Entry entry;
+        entry.op = static_cast<Operation>(q[0]);
+        int fieldCount = q[1];
+        q += 2;
+
+        bool complete = true;
+        for (int i = 0; i < fieldCount; ++i) {
+            if (payloadEnd - q < 4) {
+                complete = false;
+                break;
+            }
+            quint32 len = BinaryFormat::readU32(q);
+            q += 4;
+            if (static_cast<quint64>(payloadEnd - q) < len) {
+                complete = false;
+                break;
+            }
+            entry.fields.append(QString::fromUtf8(reinterpret_cast<const char *>(q), len));
+            q += len;
+        }
+        if (!complete) {
+            break;
+        }
+
+        entries.append(entry);
+        p += 8 + length;
+    }
+
+    if (validLength) {
+        *validLength = p - reinterpret_cast<const uchar *>(data.constData());
+    }
+    return entries;
+}
+
+// 截掉最后一条完整记录之后的内容，否则之后追加的记录排在坏记录后面，永远不会被回放
+bool LibraryJournal::truncateJournal(const QString &dataFile, qint64 validLength)
+{
+    QFile file(journalPath(dataFile));
+    if (!file.exists()) {
+        return true;
+    }
+    if (validLength < 0) {
+        return false;
+    }
+    if (file.size() <= validLength) {
+        return true;
+    }
+
+    qDebug() << "日志末尾有" << file.size() - validLength << "字节无法回放，已截断：" << file.fileName();
+    if (validLength == 0) {
+        return file.remove();
+    }
+    return file.resize(validLength);
+}
+
+// ============== 字段转换 ==============
+
+QStringList LibraryJournal::bookFields(const Book &book)
+{
+    return QStringList{book.getId(), book.getTitle(), book.getAuthor(),
+                       QString::number(book.getCategory()),
+                       QString::number(book.getTotalCopies()),
+                       QString::number(book.getAvailableCopies()),
+                       QString::number(book.getStatus())};
+}
+
+Book LibraryJournal::bookFromFields(const QStringList &fields)
+{
+    Book book;
+    if (fields.size() >= 7) {
+        book = Book(fields[0], fields[1], fields[2],
+                    static_cast<BookCategory>(fields[3].toInt()),
+                    fields[4].toInt(), fields[5].toInt());
+        book.setStatus(static_cast<BookStatus>(fields[6].toInt()));
+    }
+    return book;
+}
+
+QStringList LibraryJournal::readerFields(const Reader &reader)
+{
+    return QStringList{reader.getId(), reader.getName(), reader.getDept(),
+                       reader.getPhone(), dateField(reader.getRegisterDate()),
+                       reader.getIsValid() ? "1" : "0"};
+}
+
+Reader LibraryJournal::readerFromFields(const QStringList &fields)
+{
+    Reader reader;
+    if (fields.size() >= 6) {
+        reader = Reader(fields[0], fields[1], fields[2], fields[3]);
+        reader.setRegisterDate(dateFromField(fields[4]));
+        reader.setValid(fields[5] == "1");
+    }
+    return reader;
+}
+
+QStringList LibraryJournal::recordFields(const BorrowRecord &record)
+{
+    return QStringList{record.getReaderId(), record.getBookId(),
+                       dateField(record.getBorrowDate()),
+                       dateField(record.getDueDate()),
+                       dateField(record.getReturnDate())};
+}
+
+BorrowRecord LibraryJournal::recordFromFields(const QStringList &fields)
+{
+    BorrowRecord record;
+    if (fields.size() >= 5) {
+        record = BorrowRecord(fields[0], fields[1],
+                              dateFromField(fields[2]),
+                              dateFromField(fields[3]),
+                              dateFromField(fields[4]));
+    }
+    return record;
+}
+
+// 日期以儒略日保存，空日期保存为空字符串
+QString LibraryJournal::dateField(const QDate &date)
+{
+    return date.isValid() ? QString::number(date.toJulianDay()) : QString();
+}
+
+QDate LibraryJournal::dateFromField(const QString &field)
+{
+    return field.isEmpty() ? QDate() : QDate::fromJulianDay(field.toLongLong());
+}
@@ -0,0 +1,236 @@
+#include "librarysnapshot.h"
+#include "binaryformat.h"
+#include "sectionscanner.h"
+#include <QFile>
+#include <QHash>
+#include <QSaveFile>
+#include <QTextStream>
+#include <QDebug>
+#include <algorithm>
+#include <climits>
+#include <functional>
+
+namespace {
+
+typedef std::function<void(QTextStream &)> SectionWriter;
+
+// 调试版本中把段重新序列化，与原样复制的字节比对（忽略换行符差异）
+bool sameAsSerialized(const char *data, qint64 length, const SectionWriter &write)
+{
+    QByteArray serialized;
+    QTextStream stream(&serialized);
+    stream.setEncoding(QStringConverter::Utf8);
+    write(stream);
+    stream.flush();
+
+    QByteArray copied(data, static_cast<int>(length));
+    copied.replace("\r", "");
+    if (!copied.endsWith('\n')) {
+        copied.append('\n');
+    }
+    return copied == serialized;
+}
+
+} // namespace
+
+bool LibrarySnapshot::writeText(const QString &filename) const
+{
+    // 扫描上次完整保存的文件，找出可以原样复制的段
+    QFile base(baseFile);
+    uchar *mapped = nullptr;
+    const char *baseData = nullptr;
+    QHash<QByteArray, SectionScanner::Section> baseSections;
+    if (dirtySections != AllDirty && !baseFile.isEmpty() && base.open(QIODevice::ReadOnly)) {
+        qint64 baseSize = base.size();
+        mapped = (baseSize > 0) ? base.map(0, baseSize) : nullptr;
+        if (mapped) {
+            baseData = reinterpret_cast<const char *>(mapped);
+            for (const SectionScanner::Section &section :
+                 SectionScanner::scan(baseData, baseSize, INT_MAX)) {
+                baseSections.insert(section.name, section);
+            }
+        }
+    }
+
+    QSaveFile file(filename);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
+        qDebug() << "无法打开文件进行写入：" << filename;
+        return false;
+    }
+
+    QTextStream out(&file);
+    out.setEncoding(QStringConverter::Utf8);
+
+    // 段未修改且旧文件中的记录数与当前一致时复制原始字节，否则用 write 重新序列化。
+    // 原样复制的段必须与重新序列化的结果相同，否则写出的内容会取决于其他段是否被修改
+    auto writeSection = [&](int flag, const char *name, int expectedCount,
+                            const SectionWriter &write) {
+        auto it = baseSections.constEnd();
+        if (baseData && !(dirtySections & flag)) {
+            it = baseSections.constFind(name);
+        }
+        if (it == baseSections.constEnd() || (expectedCount >= 0 && it->count != expectedCount)) {
+            write(out);
+            return;
+        }
+
+        const char *begin = baseData + it->headerOffset;
+        qint64 length = it->endOffset - it->headerOffset;
+        Q_ASSERT_X(sameAsSerialized(begin, length, write), "LibrarySnapshot::writeText",
+                   "原样复制的段与重新序列化的结果不一致");
+
+        out.flush();
+        file.setTextModeEnabled(false);
+        file.write(begin, length);
+        if (length > 0 && begin[length - 1] != '\n') {
+            file.write("\n");
+        }
+        file.setTextModeEnabled(true);
+    };
+
+    // 保存图书数据
+    writeSection(BooksDirty, "BOOKS", books.size(), [this](QTextStream &stream) {
+        stream << "#BOOKS\n";
+        stream << books.size() << "\n";
+        for (const Book &book : books) {
+            book.saveToStream(stream);
+        }
+    });
+
+    // 保存读者数据
+    writeSection(ReadersDirty, "READERS", readers.size(), [this](QTextStream &stream) {
+        stream << "#READERS\n";
+        stream << readers.size() << "\n";
+        for (const Reader &reader : readers) {
+            reader.saveToStream(stream);
+        }
+    });
+
+    // 保存借阅记录（先写历史段中的记录）
+    int historyCount = history ? history->size() : 0;
+    writeSection(BorrowsDirty, "BORROWS", historyCount + borrowRecords.size(),
+                 [this, historyCount](QTextStream &stream) {
+        stream << "#BORROWS\n";
+        stream << historyCount + borrowRecords.size() << "\n";
+        for (int i = 0; i < historyCount; ++i) {
+            history->recordAt(i).saveToStream(stream);
+        }
+        for (const BorrowRecord &record : borrowRecords) {
+            record.saveToStream(stream);
+        }
+    });
+
+    // 保存预定记录
+    writeSection(ReservationsDirty, "RESERVATIONS", reservations.size(), [this](QTextStream &stream) {
+        stream << "#RESERVATIONS\n";
+        stream << reservations.size() << "\n";
+        for (const auto &reservation : reservations) {
+            stream << reservation.first << "," << reservation.second << "\n";
+        }
+    });
+
+    // 保存时间设置
+    writeSection(SettingsDirty, "SETTINGS", -1, [this](QTextStream &stream) {
+        stream << "#SETTINGS\n";
+        stream << (useCustomTime ? "1" : "0") << "\n";
+        if (useCustomTime) {
+            stream << customCurrentDate.toString("yyyy-MM-dd") << "\n";
+        }
+    });
+
+    // 旧文件通常就是目标文件，替换前先释放映射
+    if (mapped) {
+        base.unmap(mapped);
+    }
+    base.close();
+
+    // 先写入临时文件，全部成功后才原子替换目标文件，中途失败不会留下半个文件
+    out.flush();
+    if (out.status() != QTextStream::Ok || !file.commit()) {
+        qDebug() << "保存文件时发生错误：" << filename;
+        return false;
+    }
+    return true;
+}
+
+bool LibrarySnapshot::writeBinary(const QString &filename) const
+{
+    BinaryFormat::Writer writer;
+
+    // 图书段：每个字段单独成列
+    writer.beginSection(BinaryFormat::BookSection);
+    writer.writeU32(books.size());
+    for (const Book &book : books) writer.writeString(book.getId());
+    for (const Book &book : books) writer.writeString(book.getTitle());
+    for (const Book &book : books) writer.writeString(book.getAuthor());
+    for (const Book &book : books) writer.writeI32(book.getTotalCopies());
+    for (const Book &book : books) writer.writeI32(book.getAvailableCopies());
+    for (const Book &book : books) writer.writeU8(static_cast<quint8>(book.getCategory()));
+    for (const Book &book : books) writer.writeU8(static_cast<quint8>(book.getStatus()));
+    writer.alignSection();
+
+    // 读者段
+    writer.beginSection(BinaryFormat::ReaderSection);
+    writer.writeU32(readers.size());
+    for (const Reader &reader : readers) writer.writeString(reader.getId());
+    for (const Reader &reader : readers) writer.writeString(reader.getName());
+    for (const Reader &reader : readers) writer.writeString(reader.getDept());
+    for (const Reader &reader : readers) writer.writeString(reader.getPhone());
+    for (const Reader &reader : readers) writer.writeDate(reader.getRegisterDate());
+    for (const Reader &reader : readers) writer.writeU8(reader.getIsValid() ? 1 : 0);
+    writer.alignSection();
+
+    // 未归还的记录写入借阅段，已归还的记录按借阅日期排序后写入历史段
+    QVector<BorrowRecord> openRecords;
+    QVector<BorrowRecord> closedRecords;
+    if (history) {
+        closedRecords.reserve(history->size());
+        for (int i = 0; i < history->size(); ++i) {
+            closedRecords.append(history->recordAt(i));
+        }
+    }
+    for (const BorrowRecord &record : borrowRecords) {
+        (record.isReturned() ? closedRecords : openRecords).append(record);
+    }
+    std::stable_sort(closedRecords.begin(), closedRecords.end(),
+                     [](const BorrowRecord &a, const BorrowRecord &b) {
+                         return a.getBorrowDate() < b.getBorrowDate();
+                     });
+
+    // 借阅段
+    writer.beginSection(BinaryFormat::BorrowSection);
+    writer.writeU32(openRecords.size());
+    for (const BorrowRecord &record : openRecords) writer.writeString(record.getReaderId());
+    for (const BorrowRecord &record : openRecords) writer.writeString(record.getBookId());
+    for (const BorrowRecord &record : openRecords) writer.writeDate(record.getBorrowDate());
+    for (const BorrowRecord &record : openRecords) writer.writeDate(record.getDueDate());
+    for (const BorrowRecord &record : openRecords) writer.writeDate(record.getReturnDate());
+
+    // 预定段
+    writer.beginSection(BinaryFormat::ReservationSection);
+    writer.writeU32(reservations.size());
+    for (const auto &reservation : reservations) writer.writeString(reservation.first);
+    for (const auto &reservation : reservations) writer.writeString(reservation.second);
+
+    // 设置段
+    writer.beginSection(BinaryFormat::SettingsSection);
+    writer.writeU8(useCustomTime ? 1 : 0);
+    writer.alignSection();
+    writer.writeI32(useCustomTime ? BinaryFormat::dateToDay(customCurrentDate) : BinaryFormat::NullDay);
+
+    // 历史段放在最后，此时字符串表已包含所有图书和读者编号
+    HistorySegment::write(writer, closedRecords);
+
+    QSaveFile file(filename);
+    if (!file.open(QIODevice::WriteOnly)) {
+        qDebug() << "无法打开文件进行写入：" << filename;
+        return false;
+    }
+
+    QByteArray data = writer.finish();
+    if (file.write(data) != data.size() || !file.commit()) {
+        qDebug() << "保存文件时发生错误：" << filename;
+        return false;
+    }
+    return true;
+}
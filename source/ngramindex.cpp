@@ -0,0 +1,122 @@
+#include "ngramindex.h"
+#include <algorithm>
+#include <iterator>
+
+// 逐字符折叠大小写，与 QString::contains(..., Qt::CaseInsensitive) 的比较方式一致
+QString NgramIndex::fold(const QString &text)
+{
+    QString folded = text;
+    for (QChar &c : folded) {
+        c = c.toCaseFolded();
+    }
+    return folded;
+}
+
+// 片段编码：高 16 位为长度，低 48 位依次为各 UTF-16 码元
+quint64 NgramIndex::gramKey(const QChar *p, int n)
+{
+    quint64 key = static_cast<quint64>(n) << 48;
+    for (int i = 0; i < n; ++i) {
+        key |= static_cast<quint64>(p[i].unicode()) << (16 * i);
+    }
+    return key;
+}
+
+void NgramIndex::collectGrams(const QString &text, QVector<quint64> *grams)
+{
+    const QChar *p = text.constData();
+    int length = text.size();
+    for (int i = 0; i < length; ++i) {
+        for (int n = 1; n <= 3 && i + n <= length; ++n) {
+            grams->append(gramKey(p + i, n));
+        }
+    }
+}
+
+void NgramIndex::insert(quint32 doc, const QStringList &fields)
+{
+    remove(doc);
+
+    QVector<quint64> grams;
+    for (const QString &field : fields) {
+        collectGrams(fold(field), &grams);
+    }
+    std::sort(grams.begin(), grams.end());
+    grams.erase(std::unique(grams.begin(), grams.end()), grams.end());
+
+    for (quint64 gram : grams) {
+        QVector<quint32> &list = postings[gram];
+        // 按编号递增插入时直接追加
+        if (list.isEmpty() || list.last() < doc) {
+            list.append(doc);
+        } else {
+            list.insert(std::lower_bound(list.begin(), list.end(), doc), doc);
+        }
+    }
+    docGrams.insert(doc, grams);
+}
+
+void NgramIndex::remove(quint32 doc)
+{
+    auto it = docGrams.find(doc);
+    if (it == docGrams.end()) {
+        return;
+    }
+
+    for (quint64 gram : *it) {
+        auto posting = postings.find(gram);
+        if (posting == postings.end()) {
+            continue;
+        }
+        auto pos = std::lower_bound(posting->begin(), posting->end(), doc);
+        if (pos != posting->end() && *pos == doc) {
+            posting->erase(pos);
+        }
+        if (posting->isEmpty()) {
+            postings.erase(posting);
+        }
+    }
+    docGrams.erase(it);
+}
+
+void NgramIndex::clear()
+{
+    postings.clear();
+    docGrams.clear();
+}
+
+QVector<quint32> NgramIndex::candidates(const QString &query) const
+{
+    QString folded = fold(query);
+    int length = folded.size();
+    if (length == 0) {
+        return QVector<quint32>();
+    }
+    if (length <= 3) {
+        return postings.value(gramKey(folded.constData(), length));
+    }
+
+    // 取出所有三元组的倒排表，从最短的开始求交集
+    QVector<const QVector<quint32> *> lists;
+    for (int i = 0; i + 3 <= length; ++i) {
+        auto it = postings.constFind(gramKey(folded.constData() + i, 3));
+        if (it == postings.constEnd()) {
+            return QVector<quint32>();
+        }
+        lists.append(&it.value());
+    }
+    std::sort(lists.begin(), lists.end(),
+              [](const QVector<quint32> *a, const QVector<quint32> *b) {
+                  return a->size() < b->size();
+              });
+
+    QVector<quint32> result = *lists.first();
+    for (int i = 1; i < lists.size() && !result.isEmpty(); ++i) {
+        QVector<quint32> merged;
+        std::set_intersection(result.constBegin(), result.constEnd(),
+                              lists[i]->constBegin(), lists[i]->constEnd(),
+                              std::back_inserter(merged));
+        result.swap(merged);
+    }
+    return result;
+}
@@ -0,0 +1,1138 @@
+#include "pinyin.h"
+
+namespace Pinyin {
+
+namespace {
+
+// 以下两个表由脚本生成：汉字取最常用的一个读音，不带声调，ü 记为 u
+const char *const Syllables[] = {
+    "", "a", "ai", "an", "ang", "ao", "ba", "baak", "bai", "ban", "bang", "bao", "bei", "ben",
+    "beng", "bi", "bian", "biao", "bie", "bin", "bing", "bo", "bu", "ca", "cai", "can", "cang",
+    "cao", "ce", "cen", "ceng", "cha", "chai", "chan", "chang", "chao", "che", "chen", "cheng",
+    "chi", "chong", "chou", "chu", "chua", "chuai", "chuan", "chuang", "chui", "chun", "chuo",
+    "ci", "cong", "cou", "cu", "cuan", "cui", "cun", "cuo", "da", "dai", "dan", "dang", "dao",
+    "de", "den", "deng", "di", "dia", "dian", "diao", "die", "ding", "diu", "dong", "dou",
+    "du", "duan", "dui", "dun", "duo", "e", "ei", "en", "eng", "er", "fa", "fan", "fang",
+    "fei", "fen", "feng", "fiao", "fo", "fou", "fu", "ga", "gaa", "gai", "gan", "gang", "gao",
+    "ge", "gei", "gen", "geng", "gong", "gou", "gu", "gua", "guai", "guan", "guang", "gui",
+    "gun", "guo", "gwaan", "ha", "hai", "han", "hang", "hao", "he", "hei", "hen", "heng", "hm",
+    "hong", "hou", "hu", "hua", "huai", "huan", "huang", "hui", "hun", "huo", "ji", "jia",
+    "jian", "jiang", "jiao", "jie", "jin", "jing", "jiong", "jiu", "ju", "juan", "jue", "jun",
+    "ka", "kai", "kan", "kang", "kao", "ke", "kei", "ken", "keng", "kong", "kou", "ku", "kua",
+    "kuai", "kuan", "kuang", "kui", "kun", "kuo", "la", "lai", "lan", "lang", "lao", "le",
+    "lei", "leng", "li", "lia", "lian", "liang", "liao", "lie", "lin", "ling", "liu", "lo",
+    "long", "lou", "lu", "luan", "lue", "lun", "lung", "luo", "m", "ma", "mai", "man", "mang",
+    "mao", "me", "mei", "men", "meng", "mi", "mian", "miao", "mie", "min", "ming", "miu", "mo",
+    "mou", "mu", "na", "nai", "nan", "nang", "nao", "ne", "nei", "nen", "neng", "ng", "ni",
+    "nian", "niang", "niao", "nie", "nin", "ning", "niu", "nong", "nou", "nu", "nuan", "nue",
+    "nun", "nuo", "o", "ou", "pa", "pai", "pan", "pang", "pao", "pei", "pen", "peng", "pi",
+    "pian", "piao", "pie", "pin", "ping", "po", "pou", "pu", "qi", "qia", "qian", "qiang",
+    "qiao", "qie", "qin", "qing", "qiong", "qiu", "qu", "quan", "que", "qun", "ran", "rang",
+    "rao", "re", "ren", "reng", "ri", "rong", "rou", "ru", "rua", "ruan", "rui", "run", "ruo",
+    "sa", "sai", "san", "sang", "sao", "sap", "se", "sen", "seng", "sha", "shai", "shan",
+    "shang", "shao", "she", "shei", "shen", "sheng", "shi", "shou", "shu", "shua", "shuai",
+    "shuan", "shuang", "shui", "shun", "shuo", "si", "song", "sou", "su", "suan", "sui", "sun",
+    "suo", "ta", "tai", "tan", "tang", "tao", "te", "teng", "ti", "tian", "tiao", "tie",
+    "ting", "tong", "tou", "tu", "tuan", "tui", "tun", "tuo", "wa", "wai", "wan", "wang",
+    "wei", "wen", "weng", "wo", "wu", "xi", "xia", "xian", "xiang", "xiao", "xie", "xin",
+    "xing", "xiong", "xiu", "xu", "xuan", "xue", "xun", "ya", "yan", "yang", "yao", "ye", "yi",
+    "yin", "ying", "yo", "yong", "you", "yu", "yuan", "yue", "yun", "za", "zai", "zan", "zang",
+    "zao", "ze", "zei", "zen", "zeng", "zha", "zhai", "zhan", "zhang", "zhao", "zhe", "zhen",
+    "zheng", "zhi", "zhong", "zhou", "zhu", "zhua", "zhuai", "zhuan", "zhuang", "zhui", "zhun",
+    "zhuo", "zi", "zong", "zou", "zu", "zuan", "zui", "zun", "zuo",
+};
+
+const ushort FirstHanzi = 0x4E00;
+const ushort LastHanzi = 0x9FA5;
+
+// 第 i 项为 FirstHanzi + i 的读音在 Syllables 中的下标，0 表示没有读音
+const ushort SyllableOf[LastHanzi - FirstHanzi + 1] = {
+    371, 71, 154, 259, 300, 353, 118, 345, 393, 290, 300, 353, 136, 22, 377, 206, 97, 41, 41, 404,
+    264, 250, 306, 306, 268, 20, 370, 51, 73, 316, 38, 72, 268, 180, 72, 376, 180, 367, 20, 291,
+    113, 145, 101, 366, 262, 399, 136, 141, 90, 110, 45, 33, 183, 408, 401, 6, 345, 60, 347, 401,
+    143, 177, 146, 253, 94, 371, 371, 216, 351, 145, 145, 342, 201, 371, 371, 398, 351, 390, 128, 85,
+    174, 372, 255, 245, 263, 128, 109, 38, 38, 371, 372, 366, 208, 145, 259, 370, 352, 355, 97, 145,
+    353, 128, 308, 74, 306, 136, 218, 137, 146, 306, 200, 128, 197, 190, 409, 282, 364, 367, 94, 297,
+    215, 98, 323, 377, 55, 395, 261, 398, 112, 98, 190, 183, 371, 148, 174, 196, 377, 397, 306, 306,
+    84, 42, 377, 166, 377, 380, 128, 259, 351, 143, 316, 321, 103, 103, 366, 357, 366, 259, 366, 136,
+    337, 346, 153, 58, 140, 117, 371, 33, 124, 214, 370, 355, 143, 335, 180, 355, 143, 370, 265, 21,
+    376, 357, 60, 179, 79, 347, 277, 277, 136, 136, 346, 371, 304, 277, 174, 71, 386, 142, 258, 41,
+    6, 393, 142, 141, 20, 278, 51, 92, 290, 192, 20, 26, 409, 306, 324, 393, 94, 354, 354, 342,
+    126, 336, 277, 261, 98, 101, 21, 59, 184, 371, 35, 34, 288, 34, 371, 214, 203, 277, 86, 35,
+    368, 261, 399, 250, 350, 351, 138, 137, 369, 90, 26, 277, 346, 89, 66, 87, 399, 259, 247, 377,
+    69, 78, 351, 371, 358, 153, 371, 136, 2, 351, 136, 94, 85, 361, 142, 250, 60, 94, 327, 399,
+    376, 135, 133, 377, 55, 380, 290, 347, 45, 36, 366, 261, 300, 34, 192, 26, 365, 358, 347, 401,
+    386, 354, 235, 21, 107, 225, 225, 357, 9, 362, 184, 400, 304, 269, 50, 14, 316, 137, 250, 371,
+    316, 371, 397, 68, 118, 197, 60, 401, 22, 269, 15, 394, 50, 347, 66, 401, 416, 376, 368, 331,
+    392, 121, 15, 342, 302, 377, 371, 94, 416, 106, 231, 336, 225, 354, 269, 375, 343, 261, 306, 150,
+    11, 247, 133, 121, 173, 355, 101, 368, 8, 85, 210, 137, 216, 20, 136, 123, 135, 112, 270, 333,
+    140, 50, 371, 306, 359, 304, 342, 152, 398, 97, 170, 371, 39, 162, 111, 177, 372, 306, 205, 401,
+    362, 376, 3, 189, 213, 84, 192, 73, 31, 39, 365, 105, 400, 371, 282, 56, 353, 316, 59, 189,
+    324, 140, 396, 28, 263, 163, 32, 231, 233, 142, 351, 127, 144, 38, 396, 416, 41, 265, 189, 146,
+    308, 335, 304, 340, 21, 217, 356, 16, 340, 377, 352, 53, 80, 268, 362, 111, 161, 351, 149, 371,
+    94, 180, 412, 263, 177, 375, 134, 143, 261, 290, 247, 319, 94, 352, 177, 94, 255, 11, 377, 259,
+    353, 358, 361, 377, 66, 36, 41, 398, 367, 178, 177, 170, 316, 138, 361, 94, 135, 146, 356, 243,
+    138, 17, 42, 88, 90, 366, 3, 12, 377, 358, 15, 128, 34, 398, 20, 145, 369, 55, 178, 345,
+    170, 26, 410, 101, 110, 12, 332, 308, 308, 203, 62, 326, 148, 47, 359, 249, 327, 127, 371, 259,
+    331, 98, 143, 141, 321, 34, 141, 87, 398, 159, 147, 410, 146, 261, 225, 192, 408, 350, 194, 317,
+    176, 134, 73, 409, 13, 351, 146, 216, 24, 138, 391, 370, 398, 297, 266, 231, 373, 38, 261, 367,
+    284, 399, 48, 137, 136, 347, 377, 20, 287, 331, 347, 251, 367, 90, 327, 350, 80, 357, 36, 305,
+    152, 66, 416, 31, 335, 12, 357, 132, 369, 392, 41, 367, 376, 138, 362, 390, 50, 94, 15, 398,
+    410, 206, 136, 371, 357, 365, 24, 76, 28, 396, 241, 337, 337, 12, 381, 188, 141, 347, 89, 34,
+    166, 318, 398, 319, 353, 94, 378, 280, 177, 235, 380, 139, 196, 10, 68, 327, 120, 141, 352, 299,
+    261, 148, 26, 42, 290, 12, 356, 375, 369, 326, 323, 368, 85, 20, 137, 59, 382, 327, 107, 19,
+    42, 239, 25, 175, 55, 375, 385, 410, 14, 317, 5, 45, 377, 391, 412, 300, 46, 143, 39, 297,
+    118, 393, 266, 367, 66, 357, 188, 12, 252, 142, 179, 189, 198, 261, 354, 326, 373, 73, 404, 355,
+    299, 263, 144, 340, 415, 258, 352, 173, 34, 111, 181, 259, 38, 33, 347, 136, 21, 133, 45, 334,
+    60, 140, 145, 296, 89, 354, 146, 80, 140, 138, 336, 183, 21, 107, 354, 319, 354, 139, 209, 370,
+    142, 137, 263, 250, 90, 400, 2, 289, 371, 149, 233, 33, 371, 61, 143, 363, 163, 138, 42, 60,
+    140, 297, 382, 25, 19, 3, 282, 325, 41, 32, 171, 225, 142, 261, 204, 351, 231, 267, 225, 34,
+    182, 175, 189, 165, 11, 377, 17, 383, 398, 316, 376, 120, 266, 37, 177, 330, 347, 187, 42, 33,
+    274, 308, 133, 177, 194, 383, 239, 327, 367, 175, 218, 84, 351, 380, 383, 378, 360, 40, 394, 360,
+    354, 111, 77, 155, 77, 206, 338, 34, 84, 77, 84, 142, 338, 316, 367, 367, 306, 293, 61, 261,
+    74, 89, 200, 304, 74, 7, 143, 177, 132, 282, 346, 221, 270, 180, 377, 6, 105, 185, 352, 118,
+    171, 105, 332, 110, 359, 20, 259, 146, 68, 409, 89, 368, 138, 307, 136, 371, 136, 33, 144, 200,
+    273, 221, 378, 200, 99, 273, 28, 144, 28, 382, 108, 144, 200, 400, 200, 106, 362, 206, 205, 280,
+    372, 357, 152, 149, 233, 371, 205, 306, 110, 204, 399, 146, 378, 210, 160, 183, 94, 357, 205, 20,
+    73, 325, 99, 90, 20, 128, 40, 148, 128, 165, 370, 176, 244, 94, 209, 73, 354, 182, 260, 138,
+    143, 318, 202, 338, 259, 107, 407, 317, 143, 180, 266, 69, 184, 73, 98, 138, 372, 52, 2, 177,
+    46, 210, 407, 55, 316, 79, 142, 183, 183, 231, 352, 75, 136, 86, 86, 86, 90, 146, 42, 397,
+    90, 214, 398, 94, 90, 255, 90, 151, 132, 151, 98, 65, 255, 261, 360, 163, 338, 5, 42, 136,
+    61, 118, 118, 385, 62, 69, 62, 277, 277, 46, 89, 264, 371, 136, 152, 261, 56, 42, 348, 136,
+    60, 359, 129, 345, 148, 177, 379, 182, 185, 386, 99, 46, 94, 42, 269, 69, 299, 209, 184, 399,
+    244, 18, 141, 141, 246, 177, 299, 18, 33, 143, 108, 104, 62, 46, 166, 161, 79, 84, 398, 309,
+    270, 297, 50, 155, 141, 112, 50, 112, 151, 79, 136, 331, 143, 188, 194, 386, 378, 57, 364, 156,
+    169, 261, 297, 46, 108, 138, 57, 177, 331, 88, 257, 33, 259, 46, 409, 99, 345, 21, 136, 79,
+    266, 299, 75, 138, 136, 21, 367, 146, 135, 305, 138, 79, 76, 351, 108, 94, 305, 138, 101, 58,
+    151, 46, 45, 33, 339, 189, 177, 249, 299, 252, 160, 140, 108, 263, 148, 129, 390, 408, 179, 146,
+    250, 185, 112, 140, 112, 138, 138, 327, 135, 136, 138, 371, 138, 398, 33, 138, 212, 177, 401, 177,
+    366, 270, 9, 105, 137, 351, 197, 182, 142, 158, 357, 398, 73, 401, 235, 141, 269, 301, 371, 401,
+    212, 177, 142, 173, 173, 147, 160, 368, 343, 356, 213, 165, 141, 182, 121, 306, 155, 142, 100, 21,
+    209, 39, 172, 375, 375, 206, 155, 365, 147, 266, 189, 22, 204, 39, 175, 151, 206, 73, 362, 362,
+    152, 351, 371, 365, 349, 305, 173, 214, 189, 252, 306, 136, 265, 139, 35, 270, 355, 371, 148, 86,
+    147, 336, 146, 60, 357, 197, 365, 365, 189, 177, 36, 274, 270, 11, 301, 380, 145, 11, 106, 351,
+    380, 348, 360, 97, 97, 11, 51, 371, 360, 249, 146, 328, 101, 258, 80, 246, 94, 105, 58, 145,
+    105, 15, 129, 12, 219, 306, 87, 145, 371, 381, 139, 153, 139, 165, 128, 353, 269, 86, 112, 264,
+    384, 165, 88, 128, 377, 112, 166, 133, 60, 112, 179, 179, 320, 75, 145, 148, 352, 250, 269, 371,
+    155, 367, 16, 225, 269, 306, 365, 261, 226, 288, 412, 305, 351, 133, 9, 306, 352, 345, 129, 357,
+    345, 12, 412, 408, 357, 60, 197, 217, 60, 136, 21, 310, 21, 165, 16, 22, 392, 150, 189, 376,
+    189, 352, 108, 350, 357, 141, 141, 347, 4, 267, 398, 200, 372, 347, 301, 136, 271, 190, 39, 147,
+    357, 362, 142, 271, 351, 136, 80, 266, 352, 290, 34, 347, 80, 335, 177, 395, 118, 177, 366, 366,
+    367, 302, 66, 390, 245, 366, 264, 366, 398, 28, 199, 331, 177, 302, 127, 335, 414, 57, 88, 378,
+    28, 378, 355, 367, 177, 148, 297, 68, 42, 145, 142, 5, 112, 367, 316, 177, 34, 171, 177, 367,
+    367, 378, 316, 105, 183, 281, 269, 269, 84, 175, 75, 354, 404, 290, 25, 25, 25, 25, 2, 59,
+    376, 31, 136, 376, 312, 86, 307, 109, 6, 85, 287, 306, 308, 408, 269, 307, 16, 362, 353, 244,
+    318, 136, 347, 318, 70, 285, 51, 160, 107, 146, 184, 108, 62, 160, 398, 140, 394, 6, 71, 155,
+    325, 39, 306, 376, 268, 256, 370, 120, 316, 326, 39, 174, 69, 136, 181, 126, 208, 362, 199, 39,
+    101, 363, 369, 409, 121, 136, 69, 56, 336, 210, 127, 177, 338, 355, 390, 353, 370, 189, 1, 196,
+    241, 135, 371, 149, 41, 183, 341, 372, 88, 15, 265, 265, 141, 22, 93, 6, 78, 89, 80, 118,
+    335, 158, 314, 259, 126, 398, 372, 351, 351, 35, 215, 364, 352, 47, 74, 348, 127, 126, 351, 100,
+    366, 149, 189, 80, 101, 202, 59, 203, 38, 351, 100, 94, 140, 126, 39, 305, 215, 341, 195, 371,
+    59, 241, 177, 12, 378, 114, 348, 262, 351, 80, 306, 147, 248, 348, 220, 195, 184, 273, 376, 66,
+    400, 306, 400, 334, 352, 371, 259, 255, 409, 107, 50, 347, 362, 121, 219, 353, 247, 371, 356, 304,
+    128, 210, 58, 269, 146, 118, 381, 342, 79, 257, 246, 15, 94, 368, 121, 381, 121, 117, 145, 375,
+    94, 58, 400, 343, 150, 107, 150, 416, 22, 187, 73, 231, 324, 316, 354, 135, 259, 84, 80, 111,
+    390, 352, 371, 182, 409, 208, 205, 398, 369, 136, 400, 101, 308, 383, 356, 117, 133, 162, 130, 328,
+    354, 80, 363, 361, 114, 367, 173, 371, 2, 254, 304, 336, 126, 360, 79, 343, 116, 382, 376, 70,
+    243, 355, 2, 103, 165, 366, 58, 356, 15, 133, 226, 129, 359, 163, 79, 89, 136, 233, 213, 374,
+    120, 378, 187, 257, 199, 101, 240, 39, 301, 177, 215, 412, 121, 161, 356, 354, 173, 21, 395, 390,
+    180, 6, 208, 182, 321, 94, 22, 118, 124, 104, 315, 101, 376, 367, 107, 107, 12, 118, 323, 48,
+    371, 2, 137, 338, 354, 345, 177, 352, 327, 416, 268, 36, 351, 385, 366, 74, 259, 66, 265, 197,
+    212, 126, 74, 269, 173, 180, 323, 385, 131, 172, 297, 136, 412, 350, 90, 142, 128, 259, 307, 347,
+    309, 34, 84, 177, 262, 3, 386, 374, 226, 377, 332, 170, 297, 352, 342, 128, 2, 394, 234, 157,
+    408, 408, 300, 66, 124, 183, 1, 24, 355, 341, 351, 348, 55, 297, 107, 259, 259, 328, 60, 60,
+    370, 409, 15, 55, 44, 121, 366, 259, 395, 88, 180, 354, 250, 297, 169, 386, 373, 108, 242, 395,
+    294, 404, 229, 114, 194, 367, 66, 270, 33, 21, 71, 172, 356, 146, 327, 39, 331, 3, 145, 60,
+    150, 375, 347, 217, 299, 377, 395, 169, 141, 127, 118, 70, 400, 32, 344, 239, 377, 372, 381, 369,
+    240, 206, 128, 380, 45, 133, 131, 131, 352, 121, 136, 166, 399, 347, 297, 362, 132, 79, 229, 363,
+    180, 377, 291, 39, 263, 367, 60, 248, 25, 177, 374, 390, 347, 207, 373, 248, 22, 166, 352, 377,
+    141, 188, 161, 385, 128, 331, 369, 121, 297, 361, 262, 294, 375, 319, 126, 357, 2, 323, 196, 31,
+    117, 155, 58, 291, 37, 282, 318, 343, 136, 245, 351, 261, 306, 101, 409, 141, 173, 349, 343, 316,
+    39, 120, 323, 96, 117, 323, 265, 229, 121, 398, 289, 224, 101, 215, 67, 2, 262, 336, 15, 5,
+    5, 179, 414, 395, 212, 318, 318, 326, 66, 259, 140, 40, 140, 151, 326, 299, 27, 137, 2, 356,
+    252, 188, 95, 107, 356, 128, 133, 114, 241, 354, 386, 34, 362, 256, 63, 196, 196, 128, 175, 75,
+    95, 327, 370, 14, 373, 289, 140, 205, 356, 129, 197, 273, 416, 249, 173, 356, 136, 401, 35, 166,
+    414, 356, 316, 120, 94, 181, 263, 352, 42, 33, 60, 122, 365, 80, 415, 86, 39, 133, 383, 46,
+    53, 60, 377, 341, 30, 140, 370, 352, 259, 120, 179, 362, 65, 133, 372, 258, 148, 265, 365, 229,
+    189, 316, 367, 373, 58, 392, 240, 400, 142, 233, 133, 357, 259, 80, 385, 371, 306, 140, 378, 2,
+    375, 364, 163, 377, 248, 62, 95, 125, 78, 61, 358, 289, 250, 250, 372, 414, 231, 66, 171, 324,
+    135, 282, 120, 353, 370, 79, 250, 41, 136, 142, 120, 331, 34, 365, 201, 23, 331, 189, 133, 21,
+    376, 229, 372, 128, 201, 126, 395, 177, 185, 117, 218, 356, 212, 367, 177, 189, 187, 212, 60, 37,
+    254, 250, 355, 135, 212, 352, 79, 161, 367, 33, 373, 274, 68, 169, 324, 356, 148, 49, 131, 135,
+    404, 229, 356, 23, 177, 33, 32, 177, 371, 194, 218, 381, 319, 352, 388, 138, 381, 401, 171, 229,
+    218, 171, 186, 347, 133, 372, 268, 316, 230, 138, 133, 358, 372, 217, 339, 339, 78, 153, 378, 144,
+    251, 380, 51, 128, 133, 378, 80, 114, 167, 51, 336, 338, 347, 192, 114, 272, 279, 184, 107, 114,
+    325, 114, 338, 376, 114, 372, 134, 258, 377, 118, 378, 192, 270, 377, 266, 114, 47, 347, 378, 270,
+    161, 258, 378, 378, 366, 338, 338, 338, 339, 191, 133, 371, 131, 190, 190, 338, 366, 338, 335, 305,
+    258, 189, 163, 366, 382, 347, 101, 342, 351, 112, 250, 371, 63, 261, 261, 396, 408, 61, 260, 353,
+    299, 165, 34, 259, 229, 212, 136, 137, 398, 398, 9, 365, 371, 265, 202, 149, 280, 341, 87, 13,
+    13, 326, 152, 130, 416, 158, 15, 143, 66, 143, 136, 163, 66, 143, 138, 326, 177, 6, 351, 89,
+    406, 256, 9, 327, 167, 269, 326, 398, 342, 98, 255, 68, 108, 225, 325, 250, 144, 368, 92, 5,
+    189, 268, 214, 155, 106, 364, 6, 66, 36, 184, 401, 94, 128, 398, 47, 169, 187, 187, 189, 5,
+    59, 246, 209, 359, 73, 136, 121, 189, 50, 39, 175, 97, 372, 127, 77, 394, 94, 111, 369, 79,
+    79, 112, 31, 368, 372, 85, 106, 378, 70, 357, 157, 300, 307, 80, 20, 68, 126, 366, 162, 58,
+    150, 61, 151, 119, 219, 3, 359, 354, 378, 10, 94, 6, 371, 372, 118, 362, 47, 265, 104, 2,
+    14, 87, 271, 375, 149, 137, 66, 197, 172, 147, 38, 299, 142, 395, 182, 182, 22, 38, 129, 22,
+    306, 365, 114, 144, 370, 226, 66, 377, 22, 366, 270, 321, 250, 266, 345, 146, 192, 397, 159, 327,
+    73, 59, 326, 3, 24, 42, 14, 152, 398, 79, 371, 398, 371, 247, 136, 407, 259, 292, 146, 225,
+    161, 155, 327, 167, 225, 138, 77, 142, 99, 377, 80, 249, 107, 338, 176, 87, 366, 261, 167, 3,
+    304, 79, 219, 338, 38, 372, 134, 15, 179, 114, 70, 404, 127, 11, 11, 377, 66, 200, 141, 284,
+    80, 104, 152, 410, 377, 132, 80, 369, 367, 11, 136, 202, 34, 75, 342, 372, 90, 399, 141, 142,
+    124, 99, 48, 138, 255, 175, 355, 132, 176, 76, 345, 363, 136, 136, 163, 373, 324, 38, 375, 151,
+    319, 319, 306, 205, 324, 349, 38, 338, 327, 271, 399, 177, 399, 10, 289, 384, 77, 332, 351, 397,
+    365, 101, 396, 2, 105, 367, 152, 332, 378, 348, 357, 185, 117, 172, 34, 249, 14, 37, 189, 189,
+    241, 261, 202, 212, 404, 312, 308, 188, 39, 198, 17, 143, 28, 308, 398, 393, 152, 375, 68, 37,
+    398, 352, 114, 262, 142, 66, 300, 214, 55, 367, 324, 389, 261, 262, 180, 347, 406, 263, 389, 362,
+    299, 299, 6, 258, 163, 73, 86, 271, 212, 78, 78, 415, 66, 305, 79, 79, 326, 65, 214, 89,
+    132, 326, 58, 370, 401, 138, 5, 262, 136, 263, 157, 371, 250, 15, 68, 139, 370, 375, 364, 326,
+    171, 146, 130, 61, 274, 261, 365, 354, 352, 121, 2, 366, 62, 120, 284, 142, 175, 165, 189, 367,
+    326, 347, 130, 187, 187, 285, 177, 183, 274, 33, 365, 367, 175, 6, 345, 306, 277, 290, 405, 405,
+    305, 371, 197, 155, 401, 405, 128, 128, 167, 371, 128, 362, 167, 307, 199, 415, 307, 371, 398, 107,
+    42, 139, 90, 12, 391, 16, 321, 272, 184, 94, 57, 353, 360, 357, 219, 353, 166, 352, 344, 378,
+    200, 319, 79, 79, 370, 266, 344, 106, 106, 259, 204, 204, 372, 135, 37, 58, 386, 332, 325, 94,
+    109, 369, 368, 119, 100, 306, 328, 325, 337, 367, 15, 371, 162, 137, 79, 129, 165, 380, 137, 6,
+    82, 179, 131, 66, 367, 246, 147, 259, 216, 90, 357, 89, 68, 270, 166, 411, 131, 259, 151, 390,
+    13, 371, 139, 328, 384, 13, 352, 132, 88, 69, 365, 14, 68, 5, 302, 349, 116, 5, 351, 5,
+    139, 179, 79, 380, 139, 306, 89, 135, 15, 190, 79, 235, 235, 71, 216, 261, 138, 324, 145, 236,
+    31, 120, 354, 86, 136, 315, 282, 88, 346, 126, 405, 94, 196, 60, 277, 94, 143, 367, 117, 348,
+    399, 242, 75, 136, 158, 399, 369, 142, 380, 207, 93, 39, 379, 405, 232, 367, 215, 358, 89, 15,
+    377, 342, 90, 378, 87, 351, 377, 112, 75, 6, 225, 400, 408, 394, 58, 216, 378, 337, 354, 398,
+    80, 202, 212, 259, 15, 304, 264, 80, 121, 362, 85, 397, 209, 9, 214, 94, 184, 409, 409, 306,
+    273, 299, 368, 198, 141, 107, 316, 359, 347, 409, 146, 299, 254, 277, 369, 73, 139, 308, 136, 97,
+    355, 129, 147, 140, 106, 173, 138, 138, 371, 226, 398, 136, 136, 354, 124, 111, 149, 162, 367, 210,
+    182, 247, 80, 376, 367, 31, 304, 372, 306, 112, 270, 409, 317, 347, 126, 343, 188, 366, 275, 140,
+    190, 255, 354, 301, 177, 38, 357, 199, 94, 323, 202, 347, 155, 49, 49, 335, 227, 359, 217, 377,
+    215, 257, 221, 147, 304, 398, 118, 66, 405, 80, 254, 340, 354, 206, 351, 367, 351, 2, 367, 377,
+    316, 377, 343, 177, 354, 146, 269, 406, 259, 354, 408, 73, 34, 189, 2, 80, 80, 188, 206, 51,
+    257, 146, 256, 24, 184, 345, 17, 356, 308, 259, 133, 86, 350, 285, 326, 88, 88, 141, 332, 225,
+    270, 143, 134, 143, 261, 68, 359, 128, 345, 170, 15, 372, 400, 49, 94, 143, 192, 3, 171, 167,
+    372, 366, 146, 177, 68, 354, 129, 129, 373, 33, 304, 335, 61, 369, 351, 217, 287, 137, 337, 362,
+    377, 347, 66, 281, 202, 60, 284, 265, 133, 350, 261, 48, 207, 94, 141, 76, 371, 399, 202, 132,
+    206, 3, 373, 363, 141, 347, 202, 378, 397, 268, 306, 357, 342, 179, 200, 273, 316, 251, 347, 343,
+    53, 128, 5, 141, 11, 362, 337, 112, 42, 369, 250, 352, 378, 373, 280, 282, 39, 185, 202, 244,
+    5, 196, 106, 166, 265, 137, 292, 396, 378, 141, 280, 210, 373, 136, 319, 228, 354, 328, 245, 172,
+    219, 11, 2, 250, 254, 371, 252, 377, 175, 363, 198, 371, 393, 153, 375, 225, 177, 66, 112, 367,
+    142, 404, 34, 386, 118, 222, 173, 212, 395, 128, 128, 5, 222, 262, 196, 253, 107, 351, 263, 342,
+    392, 207, 354, 354, 212, 181, 179, 129, 112, 65, 398, 362, 371, 129, 352, 166, 275, 352, 367, 33,
+    140, 202, 86, 86, 354, 371, 133, 140, 94, 306, 15, 299, 321, 262, 179, 131, 358, 228, 73, 371,
+    25, 2, 227, 231, 196, 333, 41, 142, 50, 377, 254, 280, 282, 216, 367, 325, 373, 261, 228, 379,
+    373, 206, 15, 212, 304, 359, 225, 75, 185, 378, 171, 367, 312, 184, 140, 227, 171, 354, 373, 312,
+    133, 270, 205, 177, 190, 367, 401, 171, 409, 141, 148, 148, 159, 380, 196, 409, 56, 322, 94, 12,
+    409, 356, 358, 204, 316, 325, 11, 136, 107, 235, 364, 376, 404, 117, 190, 322, 219, 208, 51, 261,
+    308, 33, 366, 409, 225, 94, 409, 177, 364, 21, 282, 216, 229, 229, 373, 190, 206, 231, 280, 324,
+    112, 391, 267, 377, 307, 3, 338, 317, 345, 281, 369, 126, 371, 143, 407, 205, 401, 61, 126, 410,
+    110, 400, 71, 345, 371, 11, 306, 306, 40, 304, 155, 363, 306, 376, 131, 371, 333, 306, 354, 105,
+    38, 272, 105, 356, 382, 390, 11, 117, 367, 356, 137, 304, 37, 280, 132, 205, 160, 164, 19, 319,
+    24, 383, 136, 378, 136, 372, 205, 160, 266, 121, 396, 138, 94, 231, 20, 131, 202, 265, 118, 377,
+    306, 231, 142, 231, 398, 377, 11, 164, 231, 265, 212, 31, 146, 108, 265, 128, 351, 181, 306, 231,
+    391, 304, 347, 357, 164, 133, 181, 149, 131, 371, 371, 11, 265, 40, 11, 90, 56, 77, 316, 365,
+    62, 189, 77, 307, 256, 90, 404, 94, 302, 155, 139, 139, 404, 347, 415, 365, 308, 77, 62, 356,
+    141, 301, 84, 84, 84, 95, 138, 308, 37, 300, 300, 212, 95, 34, 181, 354, 354, 167, 346, 346,
+    376, 181, 181, 369, 199, 346, 346, 346, 95, 369, 79, 166, 399, 145, 98, 107, 98, 340, 98, 98,
+    306, 372, 39, 154, 225, 142, 347, 228, 146, 250, 30, 352, 15, 146, 141, 332, 269, 331, 141, 351,
+    69, 306, 306, 255, 136, 357, 396, 357, 225, 392, 352, 347, 198, 80, 188, 255, 331, 88, 308, 357,
+    338, 189, 189, 352, 30, 189, 146, 357, 146, 148, 181, 148, 308, 352, 36, 341, 225, 299, 343, 354,
+    177, 80, 133, 133, 187, 371, 259, 277, 351, 118, 304, 377, 42, 321, 259, 277, 379, 9, 369, 4,
+    366, 351, 141, 80, 136, 261, 89, 345, 259, 29, 261, 259, 31, 141, 269, 99, 354, 5, 171, 62,
+    6, 416, 416, 368, 146, 99, 155, 106, 364, 256, 177, 333, 269, 367, 94, 361, 137, 184, 342, 250,
+    5, 59, 165, 379, 269, 128, 256, 209, 3, 333, 184, 39, 255, 73, 118, 166, 361, 200, 336, 364,
+    371, 16, 121, 6, 194, 80, 94, 365, 70, 189, 82, 84, 97, 270, 73, 371, 214, 306, 3, 347,
+    131, 398, 205, 182, 136, 336, 347, 376, 260, 353, 177, 369, 140, 397, 190, 140, 80, 80, 377, 357,
+    22, 263, 272, 90, 90, 219, 177, 376, 354, 280, 62, 304, 38, 338, 104, 149, 100, 353, 372, 351,
+    172, 152, 173, 170, 354, 271, 159, 40, 40, 324, 183, 129, 146, 170, 259, 209, 167, 167, 412, 107,
+    55, 366, 366, 99, 192, 192, 176, 148, 79, 397, 114, 372, 73, 118, 397, 347, 356, 250, 367, 317,
+    141, 14, 412, 161, 73, 392, 107, 372, 409, 386, 132, 377, 344, 368, 90, 268, 368, 331, 371, 398,
+    306, 382, 369, 80, 401, 152, 189, 367, 202, 118, 136, 136, 131, 335, 305, 202, 261, 351, 377, 410,
+    171, 155, 367, 367, 347, 410, 31, 321, 280, 155, 265, 377, 259, 188, 338, 77, 352, 349, 26, 61,
+    280, 141, 151, 185, 351, 317, 263, 409, 347, 14, 68, 57, 261, 375, 229, 57, 136, 306, 287, 317,
+    410, 139, 181, 153, 33, 70, 29, 71, 338, 188, 393, 392, 392, 5, 27, 269, 262, 55, 414, 62,
+    62, 352, 377, 247, 187, 355, 30, 21, 265, 140, 367, 173, 392, 183, 181, 181, 142, 65, 79, 415,
+    140, 112, 369, 140, 369, 148, 299, 371, 364, 219, 370, 370, 371, 229, 354, 136, 357, 155, 352, 66,
+    5, 414, 347, 371, 280, 62, 184, 141, 377, 379, 372, 282, 141, 177, 112, 187, 187, 68, 280, 352,
+    146, 33, 373, 166, 367, 347, 219, 270, 35, 54, 190, 68, 68, 229, 367, 367, 367, 166, 367, 45,
+    163, 45, 400, 132, 143, 365, 35, 35, 182, 105, 416, 263, 146, 105, 146, 351, 258, 258, 31, 268,
+    268, 136, 371, 316, 6, 398, 394, 355, 371, 142, 365, 147, 6, 365, 142, 94, 381, 15, 306, 22,
+    71, 310, 86, 229, 306, 89, 242, 398, 352, 128, 60, 347, 393, 327, 59, 212, 247, 242, 334, 21,
+    179, 398, 400, 21, 398, 66, 212, 371, 371, 255, 260, 147, 282, 310, 59, 396, 313, 263, 396, 306,
+    272, 352, 10, 59, 112, 41, 255, 393, 290, 345, 59, 347, 34, 297, 259, 386, 114, 200, 75, 127,
+    397, 362, 205, 347, 350, 94, 371, 10, 255, 70, 105, 244, 132, 328, 205, 137, 330, 133, 399, 299,
+    198, 214, 17, 114, 386, 214, 10, 393, 143, 33, 94, 398, 128, 86, 46, 15, 15, 393, 205, 263,
+    33, 89, 204, 10, 41, 208, 42, 141, 354, 171, 98, 255, 226, 138, 20, 20, 359, 98, 369, 131,
+    376, 376, 136, 111, 250, 335, 386, 111, 405, 212, 266, 15, 265, 78, 46, 112, 366, 8, 141, 362,
+    189, 351, 405, 161, 373, 66, 246, 68, 366, 207, 104, 50, 94, 336, 245, 88, 355, 371, 398, 333,
+    398, 361, 75, 416, 356, 338, 112, 161, 199, 335, 376, 22, 20, 38, 170, 15, 136, 3, 308, 153,
+    375, 342, 317, 308, 266, 377, 377, 207, 318, 28, 355, 88, 145, 80, 347, 185, 297, 179, 172, 318,
+    398, 22, 266, 145, 145, 142, 5, 168, 188, 372, 181, 59, 189, 371, 42, 33, 338, 316, 358, 207,
+    34, 351, 88, 111, 161, 163, 15, 262, 357, 183, 183, 181, 189, 136, 373, 354, 335, 375, 177, 335,
+    372, 365, 367, 335, 66, 243, 138, 133, 216, 133, 105, 226, 151, 16, 371, 259, 233, 89, 146, 367,
+    371, 384, 15, 371, 371, 84, 290, 306, 84, 306, 306, 105, 69, 372, 128, 94, 126, 351, 340, 39,
+    139, 6, 304, 66, 393, 148, 328, 94, 66, 205, 354, 128, 35, 235, 143, 396, 371, 205, 270, 345,
+    301, 287, 363, 143, 69, 393, 139, 262, 249, 60, 262, 15, 15, 302, 60, 138, 106, 101, 85, 15,
+    160, 138, 18, 356, 60, 114, 139, 126, 205, 114, 345, 148, 136, 136, 112, 61, 189, 189, 339, 133,
+    398, 133, 133, 371, 371, 371, 371, 379, 379, 299, 359, 348, 336, 367, 367, 377, 39, 24, 17, 69,
+    19, 249, 375, 252, 393, 373, 39, 39, 408, 342, 136, 245, 399, 371, 346, 36, 15, 66, 184, 94,
+    346, 397, 53, 346, 143, 59, 352, 365, 123, 368, 130, 189, 127, 346, 38, 398, 362, 143, 338, 51,
+    398, 170, 51, 63, 243, 352, 73, 136, 34, 398, 51, 400, 170, 377, 357, 141, 138, 306, 137, 16,
+    132, 94, 365, 347, 245, 369, 347, 352, 397, 252, 331, 63, 397, 398, 18, 63, 40, 36, 140, 133,
+    140, 133, 202, 187, 355, 11, 269, 358, 358, 15, 371, 174, 277, 62, 71, 97, 136, 277, 277, 33,
+    326, 329, 329, 98, 259, 306, 56, 398, 346, 199, 352, 86, 373, 332, 209, 348, 399, 40, 351, 136,
+    351, 352, 137, 376, 345, 51, 317, 163, 377, 16, 398, 259, 55, 37, 325, 341, 261, 226, 134, 360,
+    232, 165, 354, 358, 153, 128, 151, 89, 130, 325, 317, 351, 241, 34, 46, 146, 371, 11, 35, 209,
+    247, 416, 388, 368, 146, 9, 235, 219, 397, 242, 22, 334, 128, 128, 146, 58, 179, 316, 41, 66,
+    59, 371, 338, 376, 94, 136, 249, 359, 378, 225, 109, 94, 352, 15, 376, 264, 363, 51, 20, 132,
+    362, 42, 15, 308, 352, 326, 375, 410, 77, 212, 398, 371, 306, 222, 365, 306, 352, 173, 124, 165,
+    213, 398, 357, 179, 333, 132, 70, 120, 159, 112, 124, 352, 140, 308, 316, 128, 268, 368, 133, 133,
+    39, 137, 371, 360, 109, 183, 133, 409, 362, 39, 300, 235, 123, 82, 155, 73, 332, 105, 270, 352,
+    260, 379, 249, 157, 63, 133, 80, 356, 336, 367, 151, 28, 219, 380, 199, 375, 375, 378, 250, 167,
+    263, 379, 377, 338, 141, 352, 395, 183, 331, 118, 120, 264, 331, 22, 371, 261, 133, 352, 12, 198,
+    371, 124, 317, 270, 38, 166, 351, 351, 376, 177, 180, 131, 51, 371, 379, 177, 230, 219, 80, 271,
+    363, 261, 351, 209, 51, 88, 12, 63, 55, 34, 203, 177, 136, 110, 110, 359, 62, 259, 159, 332,
+    192, 352, 152, 113, 225, 266, 41, 78, 114, 392, 143, 345, 378, 142, 136, 171, 377, 135, 121, 270,
+    326, 331, 331, 229, 346, 49, 128, 134, 352, 34, 358, 347, 133, 80, 323, 410, 138, 375, 68, 146,
+    25, 38, 63, 12, 264, 25, 60, 110, 79, 219, 380, 355, 406, 70, 132, 48, 267, 276, 359, 28,
+    16, 209, 410, 331, 263, 41, 12, 363, 347, 101, 261, 347, 377, 377, 15, 363, 131, 209, 15, 371,
+    206, 375, 151, 61, 372, 80, 37, 200, 260, 155, 377, 2, 264, 367, 239, 98, 380, 410, 289, 176,
+    89, 373, 166, 166, 271, 105, 380, 319, 319, 259, 369, 317, 132, 136, 107, 146, 46, 225, 357, 151,
+    397, 375, 27, 365, 304, 21, 151, 378, 352, 134, 375, 368, 177, 292, 328, 372, 50, 362, 261, 325,
+    132, 380, 304, 210, 105, 302, 51, 252, 214, 214, 114, 39, 25, 25, 25, 55, 209, 329, 393, 336,
+    5, 312, 198, 110, 271, 385, 145, 133, 151, 179, 241, 317, 265, 372, 189, 300, 347, 339, 198, 261,
+    302, 375, 266, 153, 66, 398, 188, 147, 259, 259, 377, 255, 181, 51, 376, 40, 398, 336, 38, 259,
+    269, 249, 12, 18, 267, 140, 389, 39, 179, 255, 166, 133, 263, 38, 372, 372, 352, 352, 60, 326,
+    79, 77, 77, 319, 148, 28, 356, 86, 89, 173, 173, 40, 118, 259, 354, 209, 143, 181, 351, 25,
+    148, 53, 354, 326, 305, 250, 371, 42, 354, 219, 60, 326, 143, 317, 118, 140, 347, 363, 73, 265,
+    265, 146, 27, 157, 357, 373, 5, 200, 371, 183, 294, 149, 130, 203, 171, 2, 183, 367, 168, 353,
+    39, 377, 372, 59, 204, 2, 204, 77, 259, 212, 171, 203, 41, 398, 239, 239, 367, 368, 21, 398,
+    165, 165, 376, 94, 185, 208, 38, 133, 33, 204, 171, 130, 363, 274, 33, 136, 146, 131, 302, 371,
+    179, 217, 205, 327, 148, 99, 99, 405, 101, 379, 351, 138, 362, 308, 280, 352, 38, 350, 141, 101,
+    138, 262, 135, 262, 392, 73, 259, 137, 70, 387, 137, 136, 398, 152, 136, 166, 97, 65, 392, 262,
+    101, 138, 141, 377, 138, 367, 189, 128, 392, 352, 352, 49, 59, 269, 128, 128, 128, 80, 306, 331,
+    200, 128, 177, 87, 323, 16, 68, 144, 300, 371, 371, 299, 128, 88, 367, 307, 307, 24, 390, 268,
+    174, 258, 6, 58, 278, 86, 282, 382, 342, 393, 69, 153, 377, 161, 118, 304, 31, 342, 107, 160,
+    351, 64, 261, 398, 277, 168, 203, 292, 368, 232, 9, 36, 275, 352, 261, 9, 137, 377, 94, 5,
+    352, 250, 398, 398, 80, 64, 394, 38, 136, 367, 165, 16, 35, 146, 348, 128, 379, 148, 6, 265,
+    60, 397, 380, 345, 220, 371, 308, 402, 257, 337, 74, 153, 395, 257, 94, 246, 6, 5, 386, 339,
+    160, 192, 262, 380, 128, 11, 20, 398, 249, 217, 22, 250, 325, 369, 396, 390, 368, 11, 121, 225,
+    370, 66, 39, 250, 137, 212, 202, 37, 366, 41, 269, 209, 42, 137, 94, 390, 401, 60, 32, 214,
+    226, 169, 94, 246, 9, 243, 183, 215, 109, 261, 146, 324, 6, 342, 342, 5, 146, 408, 244, 394,
+    8, 8, 66, 225, 146, 168, 187, 138, 260, 375, 171, 231, 21, 386, 261, 123, 168, 306, 141, 397,
+    230, 105, 105, 270, 311, 56, 381, 154, 371, 357, 28, 133, 254, 403, 306, 215, 8, 39, 108, 398,
+    168, 79, 79, 398, 264, 3, 233, 396, 101, 140, 162, 73, 215, 333, 182, 390, 189, 70, 343, 148,
+    182, 146, 398, 190, 366, 350, 324, 357, 219, 61, 140, 397, 136, 133, 354, 377, 2, 342, 239, 57,
+    21, 104, 331, 396, 38, 288, 288, 158, 202, 233, 146, 249, 138, 371, 335, 299, 283, 345, 357, 31,
+    90, 140, 351, 149, 145, 336, 167, 135, 338, 408, 257, 189, 6, 118, 301, 229, 147, 386, 308, 370,
+    148, 22, 345, 22, 415, 370, 391, 189, 318, 342, 173, 322, 10, 138, 131, 62, 347, 345, 265, 249,
+    302, 182, 209, 203, 94, 8, 146, 62, 350, 2, 147, 379, 410, 37, 47, 141, 338, 13, 215, 226,
+    287, 416, 350, 259, 354, 38, 68, 292, 192, 266, 99, 79, 307, 69, 257, 66, 393, 134, 136, 328,
+    260, 259, 243, 308, 261, 184, 370, 366, 148, 397, 180, 108, 371, 135, 367, 397, 191, 24, 326, 36,
+    20, 141, 331, 159, 340, 367, 57, 400, 146, 332, 261, 157, 8, 242, 141, 189, 109, 210, 141, 398,
+    60, 204, 33, 292, 110, 249, 378, 239, 138, 397, 145, 138, 377, 367, 166, 217, 126, 281, 250, 347,
+    289, 411, 363, 207, 331, 229, 31, 306, 410, 396, 371, 365, 375, 16, 368, 131, 367, 383, 3, 362,
+    366, 350, 155, 44, 136, 331, 169, 169, 37, 151, 145, 145, 338, 141, 133, 103, 40, 356, 70, 357,
+    378, 261, 370, 31, 390, 12, 369, 347, 14, 171, 348, 265, 33, 101, 188, 410, 103, 140, 106, 265,
+    280, 271, 41, 44, 392, 322, 322, 21, 42, 280, 10, 57, 292, 155, 369, 62, 398, 235, 169, 138,
+    318, 268, 100, 354, 315, 291, 142, 208, 80, 47, 239, 299, 324, 390, 327, 244, 9, 58, 177, 328,
+    128, 398, 343, 129, 261, 348, 262, 332, 396, 80, 357, 239, 270, 31, 390, 101, 351, 82, 302, 153,
+    302, 308, 8, 369, 19, 318, 326, 288, 33, 323, 145, 40, 46, 109, 20, 90, 310, 66, 259, 318,
+    391, 179, 38, 39, 110, 189, 194, 188, 410, 97, 128, 390, 46, 327, 129, 55, 216, 212, 139, 112,
+    373, 398, 5, 398, 229, 198, 33, 160, 42, 302, 339, 140, 212, 212, 395, 25, 158, 17, 139, 369,
+    106, 261, 181, 136, 373, 148, 253, 253, 173, 78, 354, 284, 112, 383, 371, 354, 38, 38, 288, 219,
+    126, 316, 118, 111, 58, 415, 226, 183, 397, 133, 405, 140, 136, 27, 60, 60, 36, 21, 36, 148,
+    94, 181, 13, 94, 263, 21, 57, 408, 404, 347, 258, 265, 78, 226, 129, 357, 189, 140, 54, 324,
+    118, 263, 350, 138, 98, 375, 175, 218, 189, 299, 408, 386, 258, 49, 136, 61, 294, 27, 266, 266,
+    131, 141, 265, 163, 60, 357, 150, 250, 21, 5, 146, 370, 80, 204, 318, 205, 136, 325, 408, 62,
+    359, 171, 23, 146, 370, 282, 370, 370, 225, 350, 141, 19, 231, 101, 398, 398, 168, 212, 138, 357,
+    182, 326, 8, 318, 189, 191, 275, 331, 244, 368, 175, 23, 308, 383, 226, 354, 149, 135, 177, 169,
+    131, 373, 189, 187, 261, 261, 383, 261, 171, 354, 373, 202, 274, 33, 349, 54, 357, 302, 194, 149,
+    205, 39, 383, 190, 326, 413, 177, 68, 343, 61, 140, 148, 171, 177, 218, 398, 112, 112, 259, 365,
+    258, 258, 307, 154, 376, 97, 371, 105, 98, 9, 87, 397, 256, 68, 160, 209, 351, 107, 121, 28,
+    356, 205, 42, 101, 66, 362, 140, 209, 37, 145, 304, 79, 377, 39, 5, 8, 362, 140, 79, 179,
+    229, 15, 34, 68, 79, 371, 98, 290, 155, 367, 78, 136, 337, 356, 79, 140, 143, 368, 353, 209,
+    308, 2, 263, 2, 397, 66, 396, 94, 308, 181, 269, 360, 371, 140, 299, 140, 408, 371, 179, 15,
+    177, 356, 356, 348, 364, 259, 259, 391, 19, 148, 391, 172, 88, 9, 9, 171, 377, 171, 347, 74,
+    305, 181, 137, 128, 357, 137, 377, 396, 140, 350, 333, 74, 142, 39, 372, 94, 262, 392, 269, 408,
+    392, 76, 57, 316, 358, 408, 408, 265, 183, 408, 42, 76, 401, 87, 33, 119, 377, 306, 247, 376,
+    202, 245, 259, 392, 200, 189, 247, 250, 185, 94, 87, 363, 143, 143, 225, 412, 394, 371, 185, 301,
+    138, 377, 371, 259, 398, 86, 252, 86, 392, 163, 321, 377, 351, 136, 136, 136, 135, 279, 60, 145,
+    398, 385, 357, 333, 365, 362, 95, 169, 98, 118, 325, 66, 362, 33, 306, 165, 368, 306, 346, 209,
+    209, 341, 48, 351, 380, 12, 4, 386, 9, 141, 167, 305, 128, 87, 120, 112, 34, 363, 210, 134,
+    89, 265, 128, 371, 352, 358, 367, 386, 87, 326, 304, 146, 368, 383, 20, 359, 373, 363, 256, 396,
+    184, 48, 120, 202, 416, 212, 16, 362, 134, 394, 410, 306, 306, 377, 88, 70, 200, 225, 34, 348,
+    73, 2, 20, 4, 400, 187, 354, 165, 333, 35, 306, 132, 132, 363, 166, 362, 140, 142, 398, 142,
+    300, 336, 126, 367, 97, 355, 298, 356, 370, 380, 133, 118, 118, 149, 345, 354, 167, 400, 352, 38,
+    305, 22, 395, 395, 351, 345, 133, 120, 37, 345, 332, 408, 414, 400, 258, 143, 352, 299, 225, 352,
+    266, 259, 143, 112, 397, 371, 398, 3, 345, 183, 180, 34, 346, 356, 383, 88, 363, 104, 371, 353,
+    380, 133, 362, 209, 166, 370, 373, 308, 347, 308, 266, 200, 217, 138, 236, 3, 368, 48, 369, 323,
+    258, 210, 140, 151, 100, 349, 34, 259, 120, 367, 177, 2, 136, 136, 203, 383, 357, 120, 214, 212,
+    51, 225, 393, 133, 11, 118, 363, 45, 181, 354, 326, 143, 253, 183, 341, 352, 371, 136, 132, 59,
+    370, 370, 177, 326, 336, 356, 88, 304, 394, 120, 371, 355, 359, 304, 140, 11, 143, 367, 2, 370,
+    282, 308, 204, 365, 369, 258, 177, 37, 165, 70, 181, 367, 135, 189, 352, 280, 187, 218, 194, 190,
+    298, 327, 367, 401, 379, 379, 269, 370, 104, 370, 128, 121, 308, 27, 27, 305, 198, 30, 30, 331,
+    414, 25, 362, 133, 372, 264, 89, 250, 379, 376, 284, 249, 89, 94, 184, 88, 269, 331, 235, 333,
+    315, 396, 172, 172, 414, 210, 132, 346, 341, 35, 136, 259, 373, 410, 346, 336, 172, 173, 204, 187,
+    214, 65, 347, 212, 13, 390, 308, 308, 214, 401, 277, 6, 258, 79, 79, 62, 177, 112, 136, 145,
+    15, 361, 38, 50, 297, 282, 381, 270, 261, 377, 98, 351, 31, 299, 365, 86, 351, 409, 177, 359,
+    24, 56, 277, 17, 342, 66, 393, 199, 39, 371, 97, 105, 75, 177, 259, 308, 99, 333, 141, 206,
+    345, 170, 145, 199, 368, 196, 207, 316, 378, 119, 88, 12, 141, 73, 100, 369, 354, 42, 48, 242,
+    308, 129, 358, 41, 401, 41, 317, 9, 317, 136, 350, 142, 106, 136, 200, 250, 15, 346, 4, 87,
+    89, 371, 94, 217, 352, 128, 366, 74, 358, 396, 369, 183, 285, 80, 202, 394, 114, 398, 51, 380,
+    129, 305, 308, 385, 66, 177, 189, 138, 38, 317, 262, 90, 392, 356, 354, 161, 255, 325, 352, 398,
+    109, 356, 137, 137, 106, 11, 212, 371, 370, 370, 306, 229, 15, 342, 371, 184, 20, 225, 169, 121,
+    9, 86, 399, 59, 50, 368, 94, 8, 213, 98, 259, 273, 281, 200, 301, 317, 395, 353, 376, 304,
+    112, 342, 390, 217, 231, 375, 66, 398, 390, 31, 60, 107, 22, 145, 5, 94, 138, 6, 79, 155,
+    216, 401, 15, 185, 32, 299, 316, 401, 247, 306, 109, 390, 369, 38, 145, 306, 398, 185, 202, 177,
+    280, 390, 385, 17, 392, 398, 187, 73, 189, 305, 177, 171, 375, 308, 365, 311, 259, 396, 259, 177,
+    371, 355, 396, 177, 294, 108, 152, 13, 277, 356, 8, 277, 20, 409, 41, 371, 50, 362, 401, 138,
+    414, 84, 84, 376, 85, 105, 154, 173, 392, 182, 372, 368, 121, 103, 371, 306, 101, 382, 190, 94,
+    141, 124, 112, 328, 111, 347, 165, 282, 3, 3, 147, 371, 408, 161, 398, 267, 336, 291, 291, 131,
+    141, 145, 364, 79, 406, 377, 383, 193, 373, 141, 185, 392, 366, 275, 396, 61, 259, 263, 129, 112,
+    139, 405, 365, 323, 297, 396, 12, 335, 168, 143, 256, 13, 94, 285, 336, 148, 352, 172, 185, 90,
+    259, 348, 149, 98, 319, 180, 268, 335, 376, 202, 10, 187, 249, 405, 66, 363, 338, 385, 5, 107,
+    15, 66, 118, 409, 398, 277, 12, 104, 138, 131, 345, 239, 137, 333, 136, 356, 189, 134, 301, 37,
+    89, 317, 204, 351, 177, 177, 74, 265, 373, 323, 146, 331, 357, 167, 408, 308, 33, 86, 347, 143,
+    177, 19, 353, 92, 328, 398, 170, 179, 138, 408, 184, 177, 259, 20, 192, 51, 261, 206, 259, 259,
+    24, 113, 33, 63, 88, 243, 10, 12, 134, 410, 38, 385, 136, 177, 249, 377, 377, 107, 149, 73,
+    327, 99, 346, 66, 57, 86, 38, 392, 259, 378, 367, 377, 270, 371, 295, 277, 47, 176, 259, 408,
+    94, 155, 170, 411, 411, 394, 110, 89, 89, 304, 266, 225, 345, 114, 189, 120, 141, 371, 41, 146,
+    146, 38, 416, 180, 262, 398, 406, 366, 146, 12, 140, 408, 409, 19, 249, 71, 42, 34, 203, 129,
+    138, 112, 352, 75, 261, 62, 112, 68, 194, 398, 270, 210, 94, 104, 249, 299, 371, 342, 295, 79,
+    370, 94, 347, 347, 76, 137, 410, 138, 371, 304, 352, 367, 367, 45, 138, 48, 377, 121, 390, 350,
+    251, 15, 369, 135, 362, 287, 368, 169, 367, 13, 133, 166, 141, 166, 316, 90, 357, 342, 398, 138,
+    214, 200, 42, 128, 128, 179, 176, 335, 217, 377, 376, 202, 317, 363, 363, 368, 396, 251, 70, 136,
+    141, 370, 42, 78, 377, 411, 347, 202, 331, 136, 141, 151, 268, 373, 281, 132, 188, 174, 270, 355,
+    254, 306, 97, 326, 171, 348, 377, 37, 189, 146, 304, 42, 15, 357, 137, 371, 392, 94, 239, 205,
+    172, 280, 107, 138, 146, 324, 369, 396, 10, 297, 378, 409, 210, 319, 137, 369, 141, 132, 98, 88,
+    390, 261, 196, 322, 378, 357, 280, 306, 398, 55, 348, 335, 185, 280, 327, 271, 391, 316, 305, 324,
+    155, 352, 107, 259, 100, 100, 322, 244, 328, 101, 48, 68, 234, 136, 315, 106, 47, 262, 31, 261,
+    130, 202, 362, 99, 100, 408, 342, 263, 368, 68, 137, 152, 414, 62, 187, 19, 401, 291, 352, 136,
+    179, 133, 375, 261, 114, 97, 97, 339, 129, 259, 295, 55, 249, 376, 128, 139, 128, 131, 112, 229,
+    371, 100, 153, 112, 112, 27, 198, 142, 66, 405, 174, 172, 37, 51, 177, 361, 266, 312, 86, 336,
+    110, 386, 319, 175, 189, 180, 205, 188, 35, 319, 155, 42, 327, 17, 189, 145, 395, 390, 308, 393,
+    198, 212, 228, 368, 333, 249, 401, 297, 352, 270, 124, 138, 51, 136, 367, 262, 364, 373, 84, 365,
+    398, 263, 414, 51, 258, 308, 129, 166, 396, 415, 379, 299, 352, 48, 68, 85, 98, 212, 351, 263,
+    275, 183, 185, 263, 354, 286, 86, 392, 342, 181, 380, 314, 78, 38, 327, 204, 146, 38, 319, 148,
+    148, 68, 133, 136, 239, 355, 342, 231, 285, 401, 336, 389, 89, 267, 273, 124, 261, 107, 185, 173,
+    100, 42, 352, 305, 409, 290, 136, 74, 143, 189, 138, 42, 378, 324, 308, 139, 326, 183, 233, 372,
+    352, 133, 299, 414, 363, 38, 98, 146, 414, 371, 265, 258, 367, 175, 90, 133, 61, 136, 321, 21,
+    255, 38, 42, 402, 112, 136, 141, 137, 266, 391, 138, 262, 62, 371, 17, 317, 302, 183, 177, 31,
+    204, 372, 328, 325, 206, 259, 339, 19, 135, 136, 261, 225, 231, 371, 100, 152, 372, 234, 266, 367,
+    259, 205, 394, 112, 48, 136, 166, 256, 65, 42, 101, 206, 376, 398, 132, 261, 175, 175, 288, 189,
+    177, 54, 189, 208, 133, 241, 189, 398, 100, 75, 378, 177, 88, 408, 318, 179, 139, 42, 266, 401,
+    189, 367, 177, 401, 37, 141, 80, 319, 130, 229, 377, 187, 170, 140, 354, 112, 146, 356, 184, 373,
+    138, 372, 376, 373, 355, 233, 21, 33, 171, 146, 312, 302, 347, 51, 270, 269, 26, 145, 377, 194,
+    177, 54, 190, 61, 148, 367, 171, 171, 401, 175, 177, 6, 218, 377, 184, 111, 261, 50, 131, 358,
+    377, 371, 261, 241, 362, 35, 42, 259, 151, 371, 148, 352, 362, 121, 377, 166, 172, 164, 315, 352,
+    2, 259, 259, 362, 39, 265, 164, 152, 164, 152, 45, 297, 108, 372, 358, 357, 377, 261, 356, 370,
+    101, 351, 326, 142, 241, 128, 331, 131, 362, 248, 352, 356, 43, 302, 299, 118, 42, 371, 80, 377,
+    49, 131, 398, 397, 50, 22, 351, 259, 22, 22, 344, 146, 261, 39, 294, 39, 294, 399, 321, 321,
+    177, 386, 377, 177, 112, 59, 80, 316, 138, 395, 212, 212, 369, 212, 53, 368, 332, 305, 59, 300,
+    362, 365, 308, 25, 148, 252, 260, 268, 319, 266, 380, 179, 371, 93, 398, 370, 25, 134, 60, 136,
+    70, 396, 380, 348, 41, 19, 331, 142, 300, 372, 69, 145, 133, 54, 371, 60, 75, 139, 179, 19,
+    75, 138, 138, 308, 241, 76, 401, 372, 266, 371, 297, 263, 155, 356, 365, 68, 133, 133, 107, 263,
+    136, 371, 241, 133, 76, 371, 356, 351, 110, 214, 202, 202, 2, 141, 75, 377, 15, 15, 15, 250,
+    250, 15, 33, 200, 120, 24, 250, 182, 137, 392, 289, 214, 342, 365, 84, 280, 354, 146, 214, 120,
+    268, 74, 297, 326, 247, 146, 79, 55, 15, 290, 290, 200, 289, 308, 308, 342, 121, 138, 324, 290,
+    189, 214, 200, 336, 280, 34, 258, 189, 392, 292, 392, 204, 189, 269, 70, 306, 66, 209, 148, 199,
+    259, 253, 216, 259, 62, 354, 45, 89, 368, 221, 19, 94, 304, 73, 266, 259, 372, 352, 117, 368,
+    3, 366, 155, 266, 366, 73, 60, 189, 266, 368, 380, 380, 313, 313, 397, 20, 375, 61, 313, 174,
+    225, 341, 86, 145, 335, 398, 268, 19, 386, 206, 54, 133, 69, 118, 31, 408, 45, 345, 86, 58,
+    352, 342, 199, 268, 259, 299, 254, 118, 261, 351, 351, 365, 316, 282, 105, 139, 39, 351, 338, 145,
+    327, 398, 398, 261, 205, 107, 346, 143, 143, 285, 149, 126, 325, 270, 136, 16, 16, 98, 348, 399,
+    87, 360, 148, 128, 232, 259, 89, 362, 362, 265, 371, 350, 380, 378, 119, 367, 304, 37, 60, 376,
+    78, 128, 135, 259, 214, 235, 202, 58, 206, 205, 40, 245, 15, 297, 398, 247, 244, 406, 381, 106,
+    185, 202, 386, 90, 241, 177, 192, 26, 90, 347, 128, 212, 202, 308, 146, 381, 342, 342, 342, 121,
+    177, 205, 371, 85, 88, 376, 332, 398, 394, 107, 392, 367, 316, 165, 144, 146, 357, 268, 371, 137,
+    399, 270, 256, 133, 205, 13, 386, 401, 174, 376, 107, 126, 98, 85, 200, 316, 128, 255, 50, 86,
+    398, 319, 231, 38, 184, 246, 21, 259, 316, 225, 146, 288, 401, 305, 175, 363, 148, 94, 244, 209,
+    325, 368, 136, 375, 110, 14, 364, 187, 189, 60, 194, 357, 256, 386, 143, 372, 244, 141, 370, 133,
+    133, 382, 38, 372, 347, 127, 138, 368, 182, 316, 136, 84, 359, 94, 288, 259, 398, 372, 351, 352,
+    154, 401, 139, 194, 194, 3, 73, 331, 213, 175, 371, 205, 270, 142, 256, 347, 356, 357, 126, 362,
+    319, 165, 328, 264, 146, 84, 400, 282, 255, 365, 360, 398, 111, 131, 210, 135, 343, 260, 243, 351,
+    269, 185, 371, 137, 143, 261, 139, 140, 396, 306, 408, 28, 85, 133, 136, 185, 33, 134, 128, 233,
+    365, 142, 182, 268, 347, 395, 149, 118, 10, 199, 408, 376, 352, 21, 74, 131, 126, 371, 258, 373,
+    171, 120, 172, 118, 177, 104, 94, 351, 179, 48, 90, 371, 377, 336, 173, 117, 142, 137, 40, 144,
+    202, 321, 38, 247, 354, 304, 338, 167, 255, 229, 118, 143, 356, 302, 226, 338, 375, 356, 354, 335,
+    80, 319, 341, 147, 29, 331, 177, 313, 316, 175, 313, 328, 75, 173, 170, 179, 347, 350, 380, 131,
+    66, 124, 286, 138, 393, 294, 94, 110, 359, 307, 311, 366, 49, 393, 370, 159, 350, 118, 342, 73,
+    121, 350, 146, 302, 180, 134, 324, 408, 68, 264, 63, 147, 409, 352, 356, 259, 107, 114, 367, 183,
+    327, 400, 249, 120, 34, 308, 259, 87, 398, 189, 219, 146, 328, 51, 175, 395, 249, 88, 317, 332,
+    250, 60, 377, 225, 377, 189, 98, 205, 143, 184, 192, 372, 55, 269, 130, 377, 226, 304, 17, 48,
+    128, 378, 170, 134, 266, 367, 261, 332, 207, 398, 372, 21, 13, 378, 348, 287, 88, 266, 378, 155,
+    136, 302, 378, 294, 189, 409, 75, 371, 138, 206, 243, 352, 377, 378, 304, 304, 281, 131, 401, 138,
+    236, 377, 268, 335, 269, 75, 86, 390, 21, 350, 350, 66, 347, 348, 282, 357, 28, 347, 121, 99,
+    367, 126, 363, 205, 155, 200, 373, 367, 376, 126, 207, 305, 202, 382, 134, 216, 112, 39, 80, 243,
+    202, 179, 259, 259, 202, 332, 52, 347, 25, 339, 206, 133, 212, 362, 136, 248, 138, 138, 128, 90,
+    355, 371, 372, 392, 306, 141, 38, 132, 326, 377, 15, 209, 306, 338, 305, 375, 146, 73, 339, 140,
+    140, 268, 367, 327, 187, 135, 378, 217, 9, 376, 270, 405, 180, 33, 354, 48, 229, 409, 345, 306,
+    198, 373, 169, 166, 90, 138, 362, 188, 347, 97, 21, 373, 256, 142, 367, 327, 378, 323, 378, 179,
+    369, 204, 407, 38, 155, 325, 58, 343, 185, 106, 292, 210, 390, 306, 371, 192, 196, 258, 347, 177,
+    382, 351, 352, 348, 262, 386, 306, 319, 2, 265, 318, 380, 361, 372, 280, 134, 319, 323, 225, 324,
+    306, 282, 2, 244, 42, 42, 245, 349, 26, 208, 101, 68, 120, 132, 352, 409, 66, 398, 359, 94,
+    141, 129, 101, 409, 328, 330, 321, 15, 140, 133, 113, 372, 100, 187, 398, 367, 302, 198, 373, 48,
+    189, 171, 190, 369, 19, 326, 377, 361, 128, 15, 17, 398, 139, 160, 304, 300, 66, 205, 5, 189,
+    128, 128, 376, 33, 86, 375, 113, 198, 266, 377, 252, 136, 366, 35, 259, 352, 136, 189, 188, 187,
+    142, 114, 51, 188, 398, 97, 262, 177, 367, 27, 140, 51, 48, 339, 241, 330, 370, 352, 205, 327,
+    212, 300, 118, 179, 171, 343, 39, 98, 90, 363, 371, 198, 409, 199, 153, 194, 249, 308, 393, 393,
+    40, 362, 131, 135, 138, 367, 312, 181, 55, 331, 368, 139, 51, 373, 126, 361, 308, 110, 373, 356,
+    410, 167, 362, 179, 398, 347, 250, 377, 140, 256, 61, 133, 141, 351, 242, 136, 244, 347, 319, 261,
+    261, 352, 189, 352, 365, 78, 132, 209, 286, 319, 181, 396, 51, 371, 395, 345, 299, 326, 35, 365,
+    166, 370, 301, 338, 401, 288, 122, 15, 299, 33, 33, 308, 336, 258, 183, 347, 294, 294, 38, 144,
+    38, 129, 140, 173, 36, 98, 56, 126, 316, 308, 249, 118, 380, 185, 126, 94, 120, 121, 354, 138,
+    299, 352, 377, 189, 171, 231, 377, 183, 206, 385, 61, 131, 386, 357, 377, 177, 306, 364, 184, 345,
+    409, 375, 133, 25, 179, 68, 370, 5, 131, 396, 33, 198, 60, 60, 371, 321, 250, 146, 324, 265,
+    136, 408, 179, 233, 114, 142, 89, 294, 136, 321, 133, 42, 324, 317, 71, 294, 401, 170, 19, 179,
+    205, 306, 308, 205, 231, 373, 373, 204, 142, 259, 15, 136, 120, 282, 55, 350, 328, 372, 372, 77,
+    50, 135, 266, 171, 149, 2, 258, 408, 347, 19, 107, 261, 373, 19, 168, 88, 26, 201, 138, 347,
+    194, 383, 189, 177, 376, 368, 189, 316, 398, 373, 75, 346, 133, 357, 244, 304, 17, 33, 212, 185,
+    138, 258, 294, 38, 107, 19, 135, 354, 189, 265, 118, 373, 280, 177, 143, 356, 373, 321, 347, 357,
+    130, 364, 401, 187, 170, 77, 86, 128, 170, 308, 184, 373, 205, 136, 179, 138, 373, 89, 183, 371,
+    138, 379, 33, 59, 274, 138, 171, 86, 312, 378, 408, 90, 302, 175, 171, 51, 269, 375, 261, 85,
+    110, 148, 367, 120, 373, 288, 383, 190, 367, 177, 205, 299, 326, 61, 140, 33, 373, 120, 6, 401,
+    171, 171, 218, 345, 190, 365, 354, 367, 98, 367, 377, 135, 17, 208, 111, 65, 133, 356, 356, 133,
+    126, 184, 385, 404, 145, 390, 357, 39, 408, 382, 382, 25, 368, 259, 399, 89, 232, 144, 348, 258,
+    371, 189, 47, 250, 151, 244, 367, 151, 245, 214, 35, 181, 271, 153, 78, 111, 358, 398, 111, 111,
+    347, 262, 16, 58, 353, 397, 401, 155, 394, 94, 6, 357, 357, 184, 408, 363, 146, 326, 246, 144,
+    246, 325, 325, 20, 368, 336, 299, 401, 390, 68, 347, 306, 179, 39, 132, 400, 128, 315, 171, 335,
+    140, 362, 124, 270, 182, 131, 368, 361, 361, 354, 372, 351, 400, 369, 306, 347, 336, 208, 382, 151,
+    126, 173, 353, 401, 363, 397, 256, 367, 133, 111, 36, 133, 154, 146, 86, 301, 370, 133, 115, 327,
+    142, 276, 182, 352, 94, 144, 357, 258, 335, 408, 335, 345, 117, 249, 172, 367, 362, 90, 39, 280,
+    128, 352, 308, 121, 365, 161, 147, 356, 352, 367, 118, 405, 149, 66, 357, 136, 351, 367, 189, 118,
+    367, 131, 203, 146, 328, 12, 89, 183, 167, 134, 341, 352, 55, 351, 126, 35, 94, 350, 140, 51,
+    90, 255, 267, 287, 352, 267, 358, 35, 367, 367, 371, 148, 377, 99, 273, 250, 360, 99, 305, 34,
+    301, 360, 226, 104, 347, 37, 121, 166, 399, 76, 353, 133, 90, 179, 363, 359, 132, 140, 138, 15,
+    373, 401, 347, 339, 299, 352, 236, 236, 33, 367, 144, 144, 377, 202, 297, 347, 390, 142, 267, 281,
+    202, 131, 362, 394, 347, 86, 268, 321, 368, 182, 401, 141, 385, 108, 11, 128, 380, 217, 306, 180,
+    16, 106, 340, 327, 35, 299, 82, 21, 132, 357, 352, 351, 352, 380, 121, 121, 352, 380, 360, 216,
+    299, 267, 369, 365, 205, 179, 373, 351, 280, 105, 367, 262, 185, 352, 15, 17, 51, 189, 138, 308,
+    371, 188, 249, 321, 371, 330, 148, 410, 380, 128, 371, 398, 5, 347, 185, 118, 241, 276, 144, 198,
+    167, 300, 54, 389, 138, 352, 352, 352, 371, 356, 39, 132, 33, 370, 326, 273, 367, 365, 263, 149,
+    65, 78, 304, 140, 89, 316, 181, 377, 183, 336, 301, 89, 86, 367, 365, 171, 202, 327, 371, 144,
+    203, 143, 140, 373, 377, 371, 364, 171, 325, 385, 25, 321, 352, 271, 410, 179, 133, 401, 357, 184,
+    347, 371, 357, 394, 133, 58, 233, 171, 282, 354, 121, 365, 142, 41, 62, 369, 121, 171, 17, 280,
+    177, 212, 11, 287, 189, 169, 5, 365, 165, 315, 181, 177, 189, 148, 181, 367, 352, 357, 187, 370,
+    25, 274, 379, 171, 51, 148, 40, 110, 146, 36, 205, 327, 171, 401, 171, 184, 54, 377, 394, 394,
+    242, 397, 246, 38, 378, 2, 347, 118, 148, 148, 94, 370, 6, 70, 370, 369, 412, 312, 84, 244,
+    46, 155, 384, 70, 262, 375, 262, 251, 9, 244, 35, 138, 243, 75, 46, 377, 390, 16, 70, 10,
+    21, 46, 376, 376, 75, 366, 38, 232, 232, 254, 145, 213, 324, 214, 173, 277, 199, 87, 200, 214,
+    99, 351, 367, 101, 12, 316, 138, 107, 376, 101, 305, 214, 66, 261, 270, 270, 409, 329, 352, 199,
+    158, 261, 351, 107, 352, 177, 177, 257, 136, 99, 398, 13, 270, 48, 75, 146, 137, 138, 90, 251,
+    155, 146, 154, 42, 352, 12, 194, 141, 196, 290, 347, 200, 78, 336, 263, 139, 352, 177, 75, 182,
+    243, 252, 21, 352, 41, 347, 166, 41, 270, 270, 6, 86, 268, 136, 32, 408, 3, 101, 405, 111,
+    196, 376, 153, 21, 127, 366, 372, 131, 405, 380, 165, 232, 66, 165, 399, 214, 12, 250, 146, 371,
+    305, 246, 353, 342, 128, 184, 88, 250, 225, 369, 376, 106, 364, 146, 60, 21, 161, 354, 231, 131,
+    123, 140, 121, 394, 136, 365, 299, 324, 280, 307, 336, 173, 75, 353, 306, 163, 397, 377, 322, 377,
+    15, 199, 352, 147, 177, 353, 372, 320, 172, 12, 398, 367, 297, 177, 118, 354, 143, 243, 88, 356,
+    8, 259, 225, 17, 372, 170, 182, 138, 262, 167, 367, 114, 410, 205, 34, 371, 398, 397, 366, 204,
+    24, 53, 302, 182, 68, 194, 128, 410, 112, 347, 90, 350, 378, 359, 401, 200, 347, 45, 354, 339,
+    366, 219, 357, 137, 127, 16, 376, 376, 202, 31, 369, 322, 21, 210, 129, 378, 318, 196, 378, 59,
+    377, 306, 120, 262, 371, 396, 26, 120, 198, 143, 139, 212, 393, 33, 5, 5, 120, 55, 13, 148,
+    15, 15, 132, 258, 183, 362, 336, 369, 181, 315, 356, 307, 78, 140, 101, 147, 75, 133, 163, 354,
+    357, 324, 354, 365, 231, 16, 135, 234, 204, 182, 219, 111, 307, 189, 324, 354, 205, 274, 131, 219,
+    194, 354, 259, 148, 363, 207, 409, 189, 189, 377, 319, 346, 268, 95, 71, 174, 6, 136, 126, 66,
+    45, 98, 145, 377, 259, 377, 368, 196, 126, 351, 94, 348, 141, 366, 19, 16, 10, 379, 148, 203,
+    148, 345, 138, 202, 60, 254, 347, 131, 354, 262, 184, 59, 371, 3, 255, 68, 94, 363, 352, 21,
+    50, 106, 137, 301, 256, 50, 155, 273, 305, 304, 371, 412, 137, 209, 299, 185, 15, 396, 396, 148,
+    85, 187, 142, 140, 138, 177, 111, 354, 400, 105, 367, 361, 368, 362, 194, 319, 401, 265, 372, 365,
+    11, 84, 355, 369, 353, 124, 112, 40, 362, 9, 247, 173, 61, 373, 134, 348, 80, 38, 66, 351,
+    351, 38, 149, 202, 12, 335, 354, 42, 118, 363, 367, 268, 363, 172, 177, 361, 94, 185, 366, 352,
+    184, 177, 142, 179, 323, 323, 90, 345, 68, 254, 392, 294, 209, 377, 146, 37, 170, 209, 305, 347,
+    332, 42, 416, 14, 38, 128, 259, 80, 167, 34, 259, 14, 345, 189, 51, 110, 367, 69, 12, 183,
+    265, 250, 242, 271, 408, 265, 85, 142, 267, 75, 141, 134, 377, 200, 202, 48, 363, 331, 359, 59,
+    281, 209, 138, 347, 284, 131, 357, 45, 138, 404, 34, 179, 270, 353, 76, 378, 366, 219, 128, 373,
+    377, 132, 285, 294, 185, 306, 280, 323, 369, 348, 351, 396, 142, 373, 196, 328, 185, 327, 177, 172,
+    112, 332, 262, 57, 148, 394, 369, 2, 19, 308, 34, 167, 404, 51, 142, 371, 55, 51, 259, 177,
+    143, 323, 268, 363, 5, 179, 203, 393, 372, 370, 373, 347, 189, 351, 65, 361, 389, 365, 269, 61,
+    183, 181, 267, 319, 132, 112, 258, 143, 86, 142, 185, 136, 133, 143, 2, 15, 25, 269, 385, 61,
+    140, 113, 326, 133, 131, 294, 321, 332, 42, 377, 142, 189, 19, 308, 348, 414, 171, 352, 409, 363,
+    284, 350, 97, 175, 75, 177, 398, 281, 177, 383, 267, 331, 112, 321, 169, 187, 189, 177, 383, 171,
+    373, 205, 355, 267, 110, 62, 383, 131, 108, 21, 70, 21, 128, 398, 252, 9, 274, 177, 343, 293,
+    355, 261, 9, 248, 87, 60, 349, 241, 86, 127, 343, 128, 184, 371, 255, 50, 8, 147, 34, 39,
+    175, 61, 204, 22, 406, 255, 16, 400, 396, 175, 50, 373, 259, 354, 188, 66, 241, 204, 404, 14,
+    183, 389, 351, 250, 60, 349, 373, 367, 98, 59, 304, 332, 332, 118, 34, 305, 266, 304, 33, 33,
+    285, 305, 319, 304, 375, 310, 189, 94, 375, 14, 90, 231, 332, 376, 137, 304, 390, 68, 94, 217,
+    68, 255, 335, 129, 335, 396, 382, 204, 15, 15, 185, 365, 185, 34, 214, 380, 86, 94, 104, 332,
+    141, 141, 270, 347, 94, 332, 214, 79, 244, 139, 343, 58, 217, 185, 13, 396, 42, 214, 214, 28,
+    332, 97, 15, 58, 398, 191, 259, 191, 244, 371, 86, 129, 302, 377, 214, 149, 371, 185, 302, 70,
+    41, 129, 61, 406, 136, 345, 139, 38, 34, 341, 175, 136, 31, 185, 70, 339, 183, 139, 139, 41,
+    250, 70, 70, 250, 141, 60, 308, 308, 398, 371, 220, 216, 71, 15, 141, 181, 99, 101, 145, 400,
+    353, 299, 362, 237, 177, 368, 37, 376, 6, 141, 148, 259, 353, 55, 15, 371, 177, 410, 46, 90,
+    401, 246, 250, 98, 155, 50, 364, 398, 60, 396, 85, 398, 330, 146, 136, 88, 146, 299, 137, 363,
+    390, 20, 229, 397, 375, 143, 270, 330, 336, 371, 141, 347, 133, 326, 368, 39, 398, 123, 366, 202,
+    74, 143, 356, 336, 338, 199, 250, 356, 320, 94, 177, 398, 57, 79, 351, 297, 173, 307, 131, 354,
+    371, 14, 393, 110, 326, 88, 196, 183, 39, 136, 332, 3, 39, 15, 15, 209, 107, 77, 80, 347,
+    377, 55, 366, 401, 53, 60, 304, 399, 39, 377, 127, 90, 169, 368, 37, 338, 377, 114, 348, 131,
+    161, 137, 372, 371, 188, 292, 148, 39, 352, 110, 371, 348, 136, 46, 9, 133, 185, 32, 307, 237,
+    68, 58, 18, 326, 393, 17, 304, 53, 194, 371, 410, 41, 393, 391, 318, 294, 271, 69, 188, 188,
+    212, 265, 372, 373, 132, 94, 181, 187, 263, 185, 173, 354, 88, 60, 372, 121, 2, 9, 354, 110,
+    112, 233, 377, 347, 371, 375, 250, 175, 177, 308, 60, 183, 68, 183, 170, 18, 136, 39, 368, 363,
+    141, 397, 201, 177, 135, 170, 136, 68, 363, 373, 372, 269, 375, 326, 68, 194, 190, 190, 21, 21,
+    112, 6, 85, 65, 85, 8, 8, 18, 136, 385, 385, 200, 63, 242, 141, 132, 112, 50, 184, 100,
+    212, 136, 140, 249, 100, 2, 80, 120, 118, 15, 345, 41, 261, 352, 2, 356, 120, 132, 120, 386,
+    55, 120, 356, 370, 256, 120, 140, 2, 359, 132, 177, 252, 121, 140, 250, 98, 246, 400, 149, 268,
+    56, 271, 390, 107, 149, 149, 400, 390, 107, 394, 75, 209, 259, 373, 377, 12, 394, 399, 248, 121,
+    373, 121, 371, 21, 345, 121, 4, 392, 367, 138, 121, 377, 166, 86, 97, 62, 244, 94, 268, 305,
+    62, 189, 392, 204, 177, 142, 362, 138, 244, 110, 3, 189, 362, 400, 61, 3, 107, 177, 214, 71,
+    98, 362, 199, 346, 398, 259, 378, 332, 355, 78, 358, 352, 244, 90, 78, 209, 210, 305, 306, 380,
+    206, 244, 87, 207, 60, 202, 200, 152, 354, 160, 306, 368, 397, 369, 304, 135, 58, 396, 165, 146,
+    304, 371, 305, 202, 212, 401, 396, 396, 206, 306, 378, 70, 225, 409, 409, 35, 390, 363, 20, 205,
+    187, 321, 336, 205, 70, 66, 220, 210, 363, 39, 165, 147, 213, 396, 333, 368, 367, 212, 399, 212,
+    395, 397, 202, 323, 301, 118, 131, 66, 38, 57, 147, 80, 198, 354, 352, 167, 170, 138, 299, 332,
+    113, 345, 176, 306, 267, 182, 366, 143, 397, 177, 170, 321, 147, 313, 321, 75, 15, 250, 214, 134,
+    225, 189, 371, 141, 24, 400, 377, 134, 196, 353, 359, 133, 113, 382, 48, 138, 202, 75, 127, 363,
+    332, 166, 100, 285, 200, 362, 85, 350, 207, 41, 166, 205, 349, 160, 61, 37, 155, 318, 353, 267,
+    212, 210, 198, 89, 386, 393, 371, 69, 160, 212, 314, 51, 188, 39, 198, 252, 38, 112, 204, 345,
+    286, 253, 352, 263, 258, 401, 65, 304, 314, 181, 36, 354, 152, 370, 362, 336, 213, 183, 112, 138,
+    370, 2, 133, 392, 138, 107, 394, 269, 202, 41, 292, 231, 365, 369, 135, 204, 206, 254, 206, 175,
+    165, 148, 363, 206, 135, 189, 204, 187, 110, 198, 352, 42, 327, 152, 401, 200, 142, 142, 377, 315,
+    386, 148, 306, 371, 304, 398, 127, 304, 373, 146, 400, 140, 57, 76, 2, 140, 389, 379, 6, 306,
+    71, 259, 136, 409, 98, 351, 395, 161, 99, 352, 86, 165, 61, 196, 297, 60, 148, 177, 94, 209,
+    80, 129, 153, 398, 259, 152, 141, 19, 80, 366, 250, 395, 367, 321, 404, 36, 78, 343, 367, 142,
+    90, 85, 212, 390, 146, 377, 155, 342, 342, 66, 391, 396, 80, 94, 214, 401, 169, 16, 235, 255,
+    249, 184, 246, 174, 256, 21, 256, 304, 381, 2, 177, 187, 336, 375, 177, 165, 42, 158, 270, 401,
+    165, 112, 80, 219, 260, 189, 133, 2, 101, 372, 359, 367, 73, 249, 352, 173, 126, 315, 353, 263,
+    266, 347, 263, 371, 158, 356, 271, 33, 172, 126, 377, 356, 353, 199, 194, 375, 36, 36, 350, 185,
+    373, 199, 271, 367, 297, 167, 377, 39, 129, 189, 37, 138, 237, 317, 408, 158, 249, 367, 406, 159,
+    38, 259, 410, 266, 183, 149, 21, 71, 134, 69, 138, 121, 189, 2, 321, 271, 176, 12, 372, 77,
+    351, 259, 192, 345, 68, 219, 12, 259, 37, 284, 367, 70, 71, 400, 342, 141, 373, 16, 155, 15,
+    347, 315, 396, 76, 353, 61, 331, 219, 249, 138, 66, 326, 31, 332, 259, 78, 90, 363, 271, 271,
+    196, 105, 226, 319, 80, 50, 185, 316, 327, 10, 129, 250, 347, 291, 175, 57, 332, 353, 352, 179,
+    244, 347, 380, 77, 395, 155, 169, 404, 369, 113, 404, 33, 259, 5, 249, 185, 189, 152, 46, 37,
+    372, 175, 17, 259, 212, 259, 55, 410, 266, 49, 192, 136, 299, 173, 269, 389, 65, 138, 352, 183,
+    71, 326, 132, 244, 381, 263, 66, 177, 138, 140, 352, 393, 263, 78, 138, 377, 406, 121, 155, 386,
+    175, 141, 42, 370, 271, 61, 371, 139, 250, 250, 377, 254, 80, 2, 155, 138, 377, 284, 204, 246,
+    50, 21, 368, 196, 23, 354, 165, 175, 175, 398, 177, 177, 86, 271, 246, 373, 177, 187, 187, 212,
+    21, 312, 110, 171, 23, 367, 306, 306, 177, 278, 302, 379, 316, 259, 324, 196, 357, 369, 354, 259,
+    259, 398, 14, 77, 399, 277, 371, 306, 376, 398, 333, 94, 94, 205, 412, 398, 320, 202, 416, 269,
+    128, 401, 304, 321, 50, 32, 205, 189, 377, 355, 351, 333, 252, 401, 112, 353, 398, 136, 100, 396,
+    100, 313, 142, 304, 97, 167, 66, 62, 135, 328, 259, 107, 110, 414, 184, 189, 20, 142, 62, 398,
+    189, 33, 15, 395, 133, 376, 352, 372, 409, 135, 396, 94, 378, 351, 354, 368, 398, 371, 202, 316,
+    66, 12, 408, 396, 375, 136, 100, 327, 316, 196, 324, 94, 363, 259, 377, 352, 136, 316, 33, 60,
+    112, 321, 177, 233, 205, 62, 177, 274, 379, 331, 383, 175, 281, 377, 377, 177, 357, 265, 121, 338,
+    361, 316, 277, 338, 409, 31, 98, 371, 354, 20, 226, 268, 268, 399, 89, 120, 380, 155, 207, 398,
+    143, 15, 398, 377, 205, 161, 9, 250, 225, 177, 376, 412, 250, 21, 184, 212, 38, 226, 265, 368,
+    416, 398, 398, 308, 146, 409, 135, 136, 38, 336, 398, 135, 121, 372, 409, 398, 141, 277, 75, 371,
+    401, 133, 233, 94, 352, 100, 172, 94, 365, 313, 189, 167, 98, 143, 331, 38, 338, 301, 313, 366,
+    192, 189, 107, 416, 277, 407, 10, 8, 136, 398, 398, 167, 176, 249, 155, 20, 41, 414, 377, 319,
+    191, 355, 371, 352, 16, 136, 94, 250, 239, 141, 399, 410, 362, 38, 62, 348, 354, 409, 377, 136,
+    362, 396, 398, 62, 137, 136, 100, 100, 107, 280, 321, 280, 136, 153, 214, 25, 202, 398, 136, 189,
+    319, 136, 373, 348, 268, 294, 121, 371, 132, 264, 136, 321, 356, 258, 140, 408, 336, 414, 189, 321,
+    233, 294, 133, 274, 239, 377, 254, 136, 340, 348, 38, 135, 165, 189, 17, 294, 274, 408, 177, 54,
+    364, 343, 145, 267, 352, 267, 159, 377, 304, 143, 369, 45, 407, 338, 173, 264, 391, 369, 16, 11,
+    369, 20, 343, 401, 140, 263, 69, 351, 112, 369, 398, 46, 369, 333, 140, 46, 144, 356, 38, 160,
+    54, 350, 60, 161, 155, 408, 362, 319, 110, 166, 74, 408, 372, 350, 343, 366, 377, 146, 267, 369,
+    369, 333, 35, 377, 332, 69, 146, 181, 352, 351, 166, 46, 394, 164, 164, 187, 38, 55, 181, 385,
+    54, 263, 267, 74, 385, 187, 264, 177, 42, 306, 94, 261, 42, 126, 259, 120, 305, 89, 308, 207,
+    269, 392, 401, 184, 187, 20, 143, 143, 393, 8, 316, 149, 126, 336, 317, 143, 69, 371, 308, 143,
+    269, 141, 255, 76, 177, 404, 30, 65, 56, 344, 143, 152, 143, 401, 401, 174, 249, 377, 39, 98,
+    199, 401, 345, 75, 136, 140, 6, 320, 136, 265, 394, 322, 366, 406, 378, 128, 119, 356, 29, 15,
+    15, 138, 371, 73, 299, 305, 58, 66, 401, 215, 39, 107, 177, 264, 209, 11, 333, 316, 94, 28,
+    13, 85, 58, 409, 66, 184, 386, 235, 94, 106, 86, 137, 98, 86, 306, 200, 256, 331, 138, 267,
+    187, 209, 16, 194, 112, 269, 39, 372, 369, 354, 15, 267, 168, 65, 356, 142, 270, 322, 282, 85,
+    165, 401, 336, 136, 58, 119, 28, 399, 160, 170, 15, 298, 61, 397, 28, 94, 380, 338, 242, 177,
+    172, 146, 110, 138, 118, 336, 353, 398, 38, 320, 306, 401, 416, 356, 301, 335, 28, 367, 100, 163,
+    98, 41, 165, 99, 380, 241, 261, 356, 138, 257, 170, 411, 15, 15, 15, 101, 325, 109, 377, 138,
+    62, 107, 39, 397, 266, 297, 400, 189, 21, 136, 183, 320, 149, 94, 390, 107, 159, 261, 261, 149,
+    47, 110, 378, 28, 412, 21, 386, 264, 342, 194, 60, 356, 287, 138, 363, 16, 322, 355, 354, 255,
+    396, 359, 128, 371, 401, 379, 48, 189, 351, 73, 315, 136, 141, 132, 359, 202, 86, 45, 404, 251,
+    90, 401, 132, 264, 127, 268, 207, 261, 107, 166, 306, 188, 380, 121, 327, 379, 41, 100, 88, 287,
+    397, 106, 229, 261, 356, 54, 187, 249, 75, 177, 15, 408, 42, 298, 39, 401, 262, 187, 171, 138,
+    22, 177, 133, 15, 66, 51, 367, 249, 25, 404, 250, 252, 74, 377, 208, 339, 386, 298, 112, 371,
+    128, 33, 160, 53, 255, 385, 136, 112, 319, 188, 28, 189, 226, 323, 54, 69, 323, 174, 76, 401,
+    356, 21, 205, 298, 61, 181, 60, 68, 94, 138, 209, 166, 59, 140, 65, 132, 322, 173, 383, 356,
+    189, 306, 383, 259, 243, 259, 243, 98, 146, 189, 189, 367, 21, 61, 289, 402, 106, 261, 179, 22,
+    400, 170, 306, 171, 166, 377, 379, 120, 396, 325, 331, 229, 41, 136, 371, 259, 330, 404, 400, 86,
+    318, 400, 261, 408, 330, 189, 189, 138, 342, 373, 377, 170, 187, 264, 179, 171, 261, 379, 399, 269,
+    179, 16, 76, 413, 177, 316, 194, 373, 379, 408, 377, 205, 66, 86, 304, 395, 304, 235, 121, 175,
+    354, 409, 225, 56, 393, 261, 391, 15, 9, 351, 297, 153, 281, 89, 15, 55, 372, 395, 205, 325,
+    128, 6, 177, 98, 146, 256, 212, 53, 392, 400, 39, 319, 333, 177, 352, 319, 126, 336, 409, 28,
+    379, 400, 183, 405, 8, 173, 89, 84, 269, 121, 180, 354, 94, 180, 25, 143, 177, 379, 189, 146,
+    259, 55, 8, 393, 183, 410, 143, 114, 129, 290, 290, 327, 16, 281, 206, 127, 362, 410, 128, 138,
+    383, 50, 177, 357, 94, 239, 12, 107, 361, 100, 327, 268, 137, 27, 405, 327, 205, 290, 89, 385,
+    153, 139, 212, 290, 290, 239, 352, 180, 139, 163, 21, 131, 308, 410, 354, 239, 339, 229, 177, 416,
+    66, 229, 333, 171, 205, 316, 145, 352, 105, 397, 145, 376, 136, 31, 400, 365, 379, 126, 377, 121,
+    345, 277, 348, 348, 268, 215, 409, 337, 232, 93, 136, 308, 48, 250, 396, 297, 126, 398, 136, 89,
+    380, 277, 60, 142, 319, 87, 323, 55, 145, 381, 6, 142, 94, 398, 259, 409, 41, 126, 381, 175,
+    352, 94, 357, 304, 21, 401, 269, 184, 401, 301, 98, 368, 94, 342, 396, 59, 42, 306, 399, 354,
+    412, 144, 9, 269, 212, 308, 414, 165, 143, 277, 119, 357, 141, 401, 41, 108, 8, 148, 165, 128,
+    50, 131, 104, 328, 141, 161, 140, 270, 97, 194, 363, 14, 354, 94, 102, 73, 280, 333, 372, 175,
+    357, 147, 362, 97, 70, 336, 316, 139, 355, 133, 148, 398, 138, 147, 39, 206, 396, 189, 38, 268,
+    308, 10, 336, 356, 131, 265, 104, 361, 331, 337, 357, 126, 352, 94, 335, 321, 77, 167, 94, 143,
+    128, 398, 367, 144, 90, 136, 362, 277, 410, 37, 79, 177, 189, 180, 41, 270, 301, 259, 259, 407,
+    259, 345, 261, 354, 307, 347, 266, 328, 345, 99, 346, 14, 406, 24, 114, 55, 192, 185, 259, 392,
+    15, 49, 184, 206, 259, 264, 332, 410, 113, 411, 352, 409, 359, 180, 142, 88, 285, 209, 377, 410,
+    86, 189, 362, 373, 300, 259, 362, 355, 138, 155, 354, 284, 206, 136, 76, 40, 66, 209, 207, 378,
+    357, 11, 316, 268, 16, 131, 104, 51, 206, 347, 94, 347, 337, 106, 207, 357, 179, 410, 16, 380,
+    372, 331, 108, 398, 380, 38, 33, 59, 353, 378, 410, 362, 305, 347, 104, 363, 373, 142, 371, 406,
+    225, 10, 107, 244, 400, 138, 50, 270, 312, 380, 353, 55, 352, 280, 328, 94, 380, 37, 100, 282,
+    128, 382, 330, 354, 319, 396, 410, 328, 132, 24, 15, 90, 53, 177, 323, 367, 352, 410, 175, 147,
+    261, 198, 398, 189, 214, 252, 179, 205, 363, 410, 136, 299, 321, 86, 189, 14, 371, 292, 213, 369,
+    262, 134, 354, 136, 297, 361, 273, 363, 321, 263, 389, 416, 398, 299, 290, 183, 377, 86, 181, 49,
+    415, 138, 275, 33, 285, 361, 133, 129, 413, 352, 262, 380, 58, 305, 133, 352, 294, 138, 139, 131,
+    385, 51, 357, 140, 15, 60, 371, 233, 321, 371, 298, 362, 136, 19, 261, 171, 258, 365, 413, 259,
+    249, 369, 212, 175, 357, 413, 165, 376, 362, 175, 354, 33, 140, 189, 33, 373, 24, 274, 354, 414,
+    413, 194, 177, 62, 171, 175, 179, 316, 145, 377, 126, 400, 354, 121, 379, 136, 345, 165, 136, 277,
+    347, 380, 126, 48, 250, 297, 99, 215, 277, 410, 192, 89, 398, 348, 87, 401, 396, 232, 308, 354,
+    98, 357, 94, 179, 412, 304, 352, 398, 399, 400, 9, 94, 42, 301, 371, 143, 59, 10, 280, 141,
+    161, 275, 70, 119, 133, 102, 363, 139, 194, 148, 140, 336, 104, 356, 147, 361, 352, 321, 328, 136,
+    331, 136, 362, 184, 373, 362, 259, 88, 49, 300, 113, 305, 347, 206, 307, 14, 41, 328, 185, 270,
+    410, 392, 345, 189, 406, 409, 155, 355, 138, 206, 171, 331, 207, 136, 380, 133, 316, 79, 76, 16,
+    354, 106, 406, 131, 66, 189, 16, 209, 378, 142, 94, 282, 396, 90, 55, 100, 33, 177, 371, 138,
+    19, 252, 198, 175, 373, 323, 213, 292, 357, 181, 299, 389, 139, 261, 263, 131, 140, 413, 93, 357,
+    99, 93, 271, 93, 259, 21, 255, 355, 394, 99, 373, 373, 266, 353, 110, 415, 326, 38, 259, 349,
+    373, 175, 326, 189, 110, 346, 346, 99, 346, 118, 194, 194, 94, 304, 85, 107, 401, 146, 200, 107,
+    209, 99, 6, 108, 331, 147, 94, 304, 367, 394, 414, 108, 408, 377, 398, 3, 85, 171, 308, 316,
+    250, 196, 185, 6, 85, 177, 35, 347, 15, 136, 389, 40, 185, 136, 147, 205, 394, 194, 250, 136,
+    136, 190, 368, 205, 262, 58, 202, 368, 376, 376, 89, 6, 100, 368, 107, 262, 384, 100, 184, 371,
+    401, 66, 361, 262, 371, 354, 280, 272, 272, 262, 131, 323, 354, 371, 368, 262, 261, 377, 104, 141,
+    327, 378, 352, 86, 299, 89, 299, 179, 175, 104, 234, 262, 33, 377, 105, 371, 40, 349, 89, 126,
+    39, 39, 55, 94, 353, 13, 371, 169, 371, 250, 184, 185, 398, 269, 352, 357, 355, 352, 352, 155,
+    263, 133, 133, 356, 297, 126, 139, 66, 55, 88, 62, 297, 39, 401, 138, 363, 39, 251, 410, 345,
+    133, 127, 121, 121, 118, 5, 252, 371, 179, 127, 5, 183, 248, 263, 5, 86, 371, 133, 363, 62,
+    369, 173, 173, 154, 200, 395, 259, 106, 106, 106, 70, 70, 84, 309, 284, 216, 216, 76, 175, 335,
+    409, 104, 35, 120, 380, 6, 250, 371, 316, 269, 137, 146, 135, 42, 173, 192, 136, 327, 241, 188,
+    234, 139, 245, 390, 188, 136, 173, 135, 376, 212, 130, 84, 371, 71, 370, 58, 317, 265, 380, 39,
+    60, 60, 126, 104, 398, 244, 229, 60, 396, 36, 184, 397, 376, 343, 181, 187, 398, 231, 333, 84,
+    366, 334, 114, 362, 179, 120, 305, 182, 254, 143, 146, 15, 66, 114, 348, 362, 255, 51, 71, 225,
+    335, 146, 51, 166, 179, 166, 51, 179, 349, 166, 179, 179, 51, 5, 305, 317, 335, 166, 229, 398,
+    60, 231, 264, 225, 335, 335, 187, 377, 377, 394, 316, 319, 371, 319, 316, 394, 394, 281, 371, 175,
+    136, 268, 157, 27, 101, 21, 131, 132, 39, 277, 356, 282, 400, 378, 75, 99, 280, 98, 31, 350,
+    34, 107, 398, 118, 94, 88, 89, 247, 245, 138, 87, 407, 376, 215, 4, 157, 273, 105, 377, 348,
+    369, 259, 250, 261, 352, 352, 88, 157, 143, 325, 304, 399, 393, 357, 304, 347, 400, 70, 60, 88,
+    6, 21, 269, 332, 12, 108, 325, 409, 88, 398, 225, 255, 409, 94, 245, 396, 354, 416, 247, 137,
+    305, 398, 11, 214, 269, 128, 155, 39, 372, 362, 368, 187, 73, 150, 189, 143, 235, 367, 245, 162,
+    371, 111, 117, 101, 73, 39, 140, 360, 360, 84, 3, 124, 251, 223, 409, 112, 38, 333, 398, 55,
+    202, 357, 55, 357, 197, 197, 136, 357, 230, 163, 288, 384, 259, 219, 205, 233, 190, 345, 21, 348,
+    345, 361, 140, 143, 376, 124, 57, 182, 299, 335, 202, 48, 304, 261, 63, 147, 53, 361, 358, 342,
+    246, 38, 221, 258, 74, 342, 228, 219, 250, 107, 194, 177, 179, 393, 55, 141, 180, 313, 250, 17,
+    192, 251, 175, 166, 47, 60, 332, 221, 143, 216, 169, 370, 367, 277, 304, 49, 94, 94, 146, 88,
+    262, 345, 73, 250, 114, 410, 71, 350, 202, 225, 404, 39, 52, 194, 241, 66, 3, 359, 219, 308,
+    311, 217, 380, 399, 281, 80, 289, 338, 369, 138, 347, 140, 377, 137, 76, 15, 34, 94, 354, 225,
+    206, 343, 330, 340, 10, 261, 189, 343, 307, 327, 319, 406, 101, 371, 21, 181, 136, 250, 357, 100,
+    189, 19, 241, 34, 189, 114, 245, 44, 17, 139, 94, 327, 212, 352, 404, 189, 140, 373, 189, 398,
+    364, 56, 183, 336, 249, 225, 44, 181, 55, 112, 356, 330, 86, 398, 140, 299, 128, 55, 286, 355,
+    321, 89, 373, 299, 402, 60, 163, 233, 341, 179, 15, 375, 148, 42, 371, 147, 169, 179, 292, 341,
+    107, 259, 55, 19, 365, 219, 350, 384, 354, 17, 359, 164, 169, 367, 189, 135, 381, 194, 269, 384,
+    190, 225, 381, 37, 261, 350, 111, 384, 183, 111, 409, 140, 229, 41, 136, 100, 41, 206, 229, 398,
+    398, 101, 138, 70, 398, 361, 325, 396, 145, 354, 377, 31, 369, 377, 40, 352, 352, 145, 377, 377,
+    359, 146, 145, 358, 302, 302, 302, 145, 306, 326, 308, 306, 332, 326, 258, 258, 110, 129, 332, 45,
+    314, 353, 351, 400, 62, 45, 299, 371, 86, 242, 325, 86, 9, 45, 119, 87, 9, 15, 189, 399,
+    138, 26, 184, 401, 386, 79, 21, 354, 101, 45, 353, 189, 267, 245, 352, 162, 94, 385, 90, 177,
+    301, 377, 172, 335, 377, 347, 21, 204, 226, 146, 132, 307, 155, 16, 214, 70, 62, 10, 31, 371,
+    318, 26, 27, 188, 59, 364, 369, 40, 65, 61, 262, 189, 371, 136, 138, 135, 204, 259, 189, 189,
+    33, 312, 103, 180, 138, 138, 294, 367, 94, 255, 367, 367, 27, 27, 371, 174, 335, 140, 2, 216,
+    333, 140, 141, 249, 345, 371, 32, 206, 205, 98, 261, 377, 377, 301, 360, 75, 128, 259, 199, 409,
+    133, 321, 398, 355, 15, 94, 341, 347, 351, 398, 259, 299, 348, 261, 277, 94, 160, 141, 189, 362,
+    136, 265, 259, 367, 89, 6, 285, 358, 136, 129, 129, 87, 351, 148, 106, 398, 380, 265, 5, 42,
+    200, 366, 88, 278, 119, 51, 372, 376, 16, 371, 264, 347, 177, 250, 80, 354, 34, 26, 401, 319,
+    331, 378, 273, 184, 325, 301, 66, 207, 266, 177, 375, 155, 214, 12, 11, 106, 209, 371, 371, 146,
+    253, 287, 161, 231, 225, 21, 20, 299, 361, 369, 354, 13, 126, 373, 390, 73, 146, 70, 229, 98,
+    128, 255, 202, 94, 305, 107, 15, 347, 94, 408, 200, 86, 137, 200, 200, 6, 50, 212, 409, 66,
+    39, 136, 143, 187, 51, 228, 378, 364, 373, 267, 101, 210, 177, 280, 372, 103, 261, 32, 37, 377,
+    120, 409, 182, 351, 136, 112, 50, 138, 50, 106, 111, 199, 31, 140, 140, 94, 377, 401, 409, 139,
+    133, 372, 31, 85, 280, 282, 40, 199, 336, 399, 261, 401, 365, 131, 94, 270, 97, 58, 143, 359,
+    45, 27, 143, 84, 3, 263, 39, 277, 138, 331, 132, 255, 177, 142, 173, 308, 405, 58, 137, 275,
+    15, 28, 263, 133, 136, 61, 409, 280, 134, 359, 194, 373, 365, 142, 322, 372, 197, 126, 400, 369,
+    75, 347, 177, 74, 94, 277, 372, 121, 15, 22, 380, 66, 338, 321, 321, 38, 37, 351, 18, 352,
+    104, 177, 258, 401, 212, 177, 405, 416, 342, 268, 297, 323, 37, 249, 146, 202, 204, 359, 143, 36,
+    304, 149, 367, 335, 376, 57, 110, 118, 376, 57, 137, 346, 319, 232, 301, 354, 172, 94, 80, 212,
+    348, 141, 217, 214, 152, 170, 179, 306, 350, 338, 354, 135, 376, 373, 373, 105, 48, 199, 199, 50,
+    345, 143, 66, 269, 73, 138, 411, 107, 169, 189, 146, 347, 149, 229, 167, 121, 258, 382, 100, 114,
+    94, 192, 34, 41, 317, 47, 392, 203, 24, 6, 177, 338, 21, 118, 11, 265, 147, 352, 265, 66,
+    141, 258, 61, 142, 263, 325, 104, 129, 107, 184, 88, 265, 3, 346, 14, 400, 367, 412, 138, 183,
+    326, 308, 332, 62, 128, 259, 121, 55, 328, 48, 15, 34, 131, 88, 170, 259, 204, 255, 347, 60,
+    297, 131, 367, 371, 333, 259, 345, 28, 216, 396, 342, 145, 334, 194, 15, 371, 244, 21, 246, 71,
+    373, 373, 373, 356, 288, 268, 155, 355, 345, 377, 377, 94, 179, 363, 363, 217, 28, 350, 48, 356,
+    377, 16, 200, 3, 80, 194, 373, 168, 168, 139, 206, 416, 416, 412, 11, 281, 352, 370, 3, 269,
+    138, 94, 189, 143, 248, 90, 126, 126, 127, 367, 338, 401, 409, 355, 277, 101, 260, 266, 205, 132,
+    304, 258, 97, 73, 400, 138, 347, 21, 347, 242, 136, 128, 384, 137, 76, 369, 149, 51, 270, 347,
+    396, 166, 335, 134, 352, 306, 259, 171, 410, 369, 378, 202, 380, 308, 66, 404, 110, 273, 364, 33,
+    151, 166, 129, 139, 188, 347, 243, 376, 318, 372, 306, 48, 306, 380, 396, 172, 282, 204, 177, 271,
+    320, 378, 177, 146, 352, 10, 42, 362, 338, 185, 135, 68, 261, 412, 256, 57, 378, 42, 377, 163,
+    244, 258, 258, 215, 315, 352, 89, 380, 397, 138, 136, 287, 26, 82, 205, 120, 322, 396, 210, 318,
+    362, 185, 352, 107, 172, 280, 349, 97, 57, 306, 327, 194, 282, 323, 363, 12, 369, 112, 15, 410,
+    113, 416, 333, 28, 247, 171, 60, 136, 177, 304, 172, 377, 184, 373, 212, 69, 333, 200, 336, 42,
+    249, 3, 179, 51, 352, 255, 268, 142, 48, 141, 347, 340, 27, 377, 371, 409, 181, 15, 189, 362,
+    22, 393, 175, 262, 198, 367, 184, 136, 252, 113, 118, 66, 319, 189, 302, 300, 66, 208, 365, 198,
+    21, 66, 57, 395, 304, 363, 347, 128, 5, 205, 188, 53, 399, 24, 256, 139, 205, 51, 228, 133,
+    147, 372, 138, 226, 308, 372, 114, 37, 128, 297, 160, 261, 196, 384, 386, 262, 74, 179, 183, 160,
+    2, 15, 177, 347, 136, 261, 305, 21, 204, 241, 33, 68, 365, 140, 285, 285, 175, 377, 263, 42,
+    129, 138, 197, 380, 11, 376, 269, 189, 275, 133, 80, 331, 88, 148, 414, 85, 282, 89, 166, 314,
+    285, 366, 362, 94, 148, 61, 351, 73, 316, 356, 352, 187, 348, 301, 259, 138, 380, 322, 184, 377,
+    353, 349, 136, 126, 316, 233, 175, 363, 380, 5, 352, 120, 11, 120, 2, 347, 133, 133, 136, 50,
+    355, 345, 208, 371, 176, 139, 25, 304, 262, 179, 155, 378, 58, 331, 327, 364, 15, 392, 322, 354,
+    86, 71, 357, 107, 357, 308, 138, 120, 126, 288, 358, 365, 369, 8, 318, 308, 365, 77, 254, 347,
+    231, 41, 197, 282, 252, 325, 136, 385, 37, 396, 84, 225, 373, 100, 51, 356, 259, 85, 138, 362,
+    166, 136, 16, 69, 205, 171, 142, 26, 207, 267, 264, 354, 181, 241, 354, 319, 189, 371, 362, 357,
+    177, 371, 169, 175, 140, 66, 398, 12, 330, 369, 212, 131, 17, 86, 318, 326, 340, 267, 263, 347,
+    185, 133, 241, 100, 380, 11, 177, 308, 42, 2, 183, 385, 363, 265, 170, 135, 342, 351, 285, 285,
+    259, 124, 189, 319, 340, 204, 380, 255, 377, 365, 136, 144, 363, 212, 268, 319, 144, 249, 229, 21,
+    274, 371, 354, 377, 146, 179, 179, 372, 262, 373, 187, 337, 129, 379, 184, 269, 369, 86, 202, 118,
+    166, 171, 136, 61, 198, 175, 175, 133, 90, 398, 347, 166, 392, 130, 177, 136, 205, 175, 130, 194,
+    136, 166, 189, 138, 288, 330, 175, 270, 356, 371, 190, 203, 18, 128, 128, 189, 237, 189, 316, 356,
+    261, 42, 128, 362, 57, 94, 362, 362, 189, 128, 377, 120, 140, 146, 114, 11, 367, 392, 392, 166,
+    19, 352, 308, 40, 268, 69, 136, 268, 71, 306, 353, 148, 395, 302, 377, 118, 409, 126, 133, 204,
+    101, 321, 353, 32, 306, 371, 196, 355, 87, 80, 6, 39, 261, 348, 348, 285, 10, 250, 379, 379,
+    149, 259, 336, 372, 259, 25, 378, 148, 133, 265, 259, 399, 366, 120, 214, 346, 89, 89, 119, 105,
+    385, 94, 273, 141, 94, 39, 74, 11, 354, 225, 59, 268, 376, 390, 255, 39, 376, 121, 118, 146,
+    177, 94, 273, 390, 106, 250, 250, 354, 401, 69, 18, 20, 107, 392, 269, 302, 334, 184, 107, 60,
+    107, 373, 177, 38, 269, 213, 101, 50, 133, 133, 199, 94, 368, 343, 182, 401, 371, 354, 168, 140,
+    177, 371, 255, 259, 116, 302, 371, 346, 212, 267, 264, 112, 267, 398, 198, 173, 395, 137, 219, 316,
+    259, 359, 141, 268, 301, 375, 137, 340, 36, 12, 80, 118, 308, 363, 90, 304, 304, 94, 354, 395,
+    351, 94, 177, 172, 15, 42, 378, 376, 141, 60, 367, 335, 68, 340, 133, 350, 398, 317, 88, 146,
+    205, 259, 259, 377, 149, 169, 204, 262, 316, 352, 192, 177, 70, 333, 328, 167, 118, 118, 377, 10,
+    88, 250, 347, 78, 371, 378, 323, 270, 261, 285, 225, 266, 347, 180, 114, 345, 73, 80, 9, 66,
+    346, 25, 368, 373, 114, 33, 71, 169, 155, 141, 357, 335, 200, 362, 206, 377, 141, 306, 363, 132,
+    367, 16, 281, 347, 94, 378, 202, 347, 94, 282, 357, 376, 268, 200, 353, 373, 306, 40, 327, 401,
+    410, 331, 94, 378, 166, 204, 169, 75, 128, 268, 70, 177, 350, 380, 269, 217, 188, 48, 280, 373,
+    139, 9, 172, 245, 316, 352, 50, 352, 378, 349, 179, 318, 9, 280, 280, 136, 351, 361, 118, 265,
+    371, 15, 129, 327, 371, 75, 216, 121, 128, 112, 196, 210, 371, 348, 373, 330, 399, 26, 292, 259,
+    198, 333, 300, 306, 27, 39, 66, 5, 189, 347, 398, 327, 37, 252, 269, 250, 377, 138, 194, 188,
+    265, 399, 372, 139, 310, 348, 356, 345, 395, 395, 196, 196, 114, 185, 200, 352, 51, 177, 198, 356,
+    34, 393, 199, 355, 212, 414, 316, 268, 329, 398, 249, 249, 140, 269, 18, 181, 244, 112, 352, 136,
+    404, 132, 88, 173, 148, 148, 133, 372, 33, 140, 299, 219, 356, 351, 40, 365, 316, 42, 38, 61,
+    177, 357, 299, 371, 143, 58, 33, 259, 50, 355, 302, 194, 265, 373, 32, 177, 387, 363, 179, 401,
+    386, 357, 199, 357, 259, 280, 138, 204, 120, 282, 135, 408, 141, 254, 121, 208, 86, 175, 141, 169,
+    209, 177, 48, 177, 268, 229, 189, 75, 356, 401, 187, 177, 187, 90, 370, 250, 218, 107, 147, 373,
+    308, 352, 25, 269, 270, 75, 25, 198, 269, 141, 401, 408, 364, 132, 235, 247, 235, 358, 399, 197,
+    84, 150, 208, 352, 359, 367, 152, 378, 269, 184, 363, 308, 354, 336, 355, 141, 354, 366, 128, 347,
+    62, 40, 347, 62, 407, 124, 269, 371, 371, 22, 98, 377, 17, 31, 371, 299, 37, 94, 113, 89,
+    310, 141, 215, 399, 60, 371, 399, 399, 141, 398, 357, 273, 398, 277, 265, 142, 149, 378, 202, 32,
+    5, 228, 133, 273, 137, 342, 184, 59, 11, 246, 369, 416, 15, 301, 326, 146, 121, 364, 361, 396,
+    371, 242, 21, 66, 343, 94, 113, 398, 398, 273, 244, 371, 200, 342, 215, 106, 363, 395, 269, 12,
+    377, 352, 205, 21, 21, 94, 39, 39, 161, 277, 139, 260, 138, 21, 141, 84, 101, 282, 401, 112,
+    372, 24, 182, 150, 359, 405, 61, 362, 167, 157, 228, 308, 137, 167, 38, 177, 147, 304, 257, 101,
+    371, 377, 396, 185, 268, 272, 136, 371, 22, 405, 313, 297, 272, 177, 179, 179, 161, 138, 93, 33,
+    15, 167, 328, 378, 184, 39, 34, 41, 79, 17, 180, 300, 247, 247, 88, 378, 194, 114, 367, 75,
+    331, 398, 146, 371, 259, 114, 108, 157, 259, 331, 331, 94, 40, 357, 16, 70, 167, 76, 361, 361,
+    121, 378, 11, 11, 94, 377, 339, 367, 133, 12, 42, 189, 246, 60, 380, 324, 106, 58, 130, 280,
+    378, 282, 216, 144, 323, 9, 340, 39, 291, 228, 373, 141, 261, 130, 161, 179, 171, 177, 395, 306,
+    189, 371, 70, 357, 354, 347, 17, 27, 136, 262, 295, 11, 355, 15, 94, 138, 404, 138, 55, 136,
+    60, 381, 86, 21, 355, 358, 18, 275, 198, 171, 5, 386, 112, 27, 321, 233, 33, 179, 15, 142,
+    61, 308, 326, 15, 171, 94, 282, 398, 77, 308, 343, 306, 8, 357, 21, 37, 170, 187, 352, 354,
+    171, 395, 59, 146, 383, 306, 138, 244, 371, 171, 366, 352, 352, 369, 90, 326, 94, 91, 94, 6,
+    121, 136, 136, 138, 110, 16, 367, 112, 148, 251, 200, 205, 205, 208, 306, 316, 33, 194, 148, 205,
+    333, 179, 369, 398, 149, 352, 299, 347, 352, 332, 377, 171, 80, 75, 265, 245, 136, 210, 373, 106,
+    269, 392, 142, 110, 65, 138, 194, 269, 138, 347, 148, 269, 194, 171, 304, 66, 110, 138, 110, 367,
+    112, 205, 306, 33, 171, 148, 136, 352, 66, 332, 377, 106, 142, 269, 140, 268, 142, 53, 148, 398,
+    35, 136, 107, 60, 409, 66, 300, 129, 270, 101, 306, 141, 112, 105, 42, 141, 134, 268, 359, 319,
+    225, 136, 189, 398, 390, 15, 359, 128, 300, 105, 398, 364, 42, 352, 371, 177, 148, 352, 367, 352,
+    367, 367, 71, 94, 268, 268, 140, 126, 136, 86, 365, 69, 126, 32, 328, 362, 141, 371, 277, 365,
+    372, 299, 259, 342, 136, 365, 372, 80, 89, 366, 369, 317, 304, 372, 358, 148, 356, 220, 37, 376,
+    398, 360, 87, 358, 35, 302, 367, 288, 407, 362, 371, 371, 319, 39, 121, 304, 121, 362, 396, 401,
+    397, 106, 409, 409, 392, 107, 94, 138, 70, 184, 66, 368, 177, 219, 244, 400, 98, 371, 146, 369,
+    390, 371, 371, 269, 394, 255, 15, 360, 269, 6, 58, 412, 328, 401, 50, 395, 375, 362, 365, 371,
+    132, 121, 306, 31, 356, 306, 123, 31, 106, 112, 270, 133, 141, 129, 97, 355, 347, 304, 400, 336,
+    205, 392, 210, 80, 133, 367, 360, 108, 84, 20, 333, 371, 175, 401, 165, 162, 351, 377, 330, 136,
+    398, 277, 53, 172, 80, 165, 81, 306, 335, 60, 12, 33, 376, 158, 263, 265, 309, 3, 377, 356,
+    38, 141, 354, 351, 351, 100, 317, 22, 133, 143, 315, 396, 315, 75, 129, 34, 313, 141, 155, 269,
+    51, 356, 321, 346, 354, 88, 39, 324, 371, 225, 372, 69, 250, 408, 33, 37, 407, 136, 259, 326,
+    406, 347, 146, 266, 73, 397, 386, 411, 261, 408, 180, 138, 42, 120, 192, 304, 17, 129, 251, 377,
+    70, 362, 251, 306, 363, 306, 134, 129, 80, 399, 66, 357, 94, 258, 335, 138, 259, 377, 409, 404,
+    352, 133, 372, 3, 354, 217, 37, 90, 401, 368, 367, 132, 363, 101, 239, 259, 213, 370, 347, 359,
+    330, 400, 299, 138, 256, 166, 132, 135, 101, 373, 205, 356, 205, 352, 262, 37, 364, 331, 319, 10,
+    39, 261, 306, 139, 378, 357, 121, 328, 369, 369, 189, 377, 17, 51, 266, 177, 212, 212, 300, 395,
+    211, 138, 386, 141, 179, 188, 25, 241, 113, 352, 408, 5, 5, 142, 395, 371, 128, 139, 198, 35,
+    118, 129, 33, 362, 389, 294, 352, 390, 77, 397, 219, 171, 80, 373, 148, 136, 415, 140, 21, 133,
+    404, 351, 388, 390, 306, 263, 326, 388, 258, 305, 363, 385, 326, 61, 321, 354, 136, 140, 143, 392,
+    218, 371, 2, 392, 250, 133, 129, 371, 371, 299, 274, 234, 261, 77, 324, 128, 400, 120, 2, 373,
+    138, 377, 138, 133, 75, 395, 363, 383, 175, 304, 347, 33, 177, 371, 16, 395, 367, 80, 41, 347,
+    41, 369, 33, 274, 372, 171, 37, 357, 229, 131, 383, 371, 61, 392, 367, 75, 367, 136, 71, 94,
+    277, 136, 141, 126, 328, 274, 299, 259, 342, 365, 371, 365, 136, 277, 139, 133, 241, 146, 366, 220,
+    362, 80, 192, 360, 317, 90, 302, 87, 148, 397, 107, 121, 255, 412, 306, 360, 390, 319, 396, 66,
+    400, 50, 269, 394, 15, 371, 371, 165, 175, 306, 108, 306, 141, 133, 38, 401, 304, 129, 60, 106,
+    270, 112, 365, 371, 397, 97, 355, 31, 134, 362, 400, 141, 351, 377, 263, 351, 100, 376, 133, 165,
+    315, 317, 81, 266, 401, 411, 239, 75, 408, 88, 155, 347, 377, 303, 304, 69, 33, 180, 407, 321,
+    326, 304, 371, 213, 37, 70, 132, 138, 357, 364, 370, 347, 80, 377, 363, 33, 409, 3, 367, 66,
+    205, 251, 362, 212, 61, 319, 357, 369, 10, 306, 261, 205, 142, 198, 395, 138, 211, 326, 388, 263,
+    171, 258, 148, 367, 261, 392, 37, 107, 261, 126, 353, 136, 126, 118, 126, 352, 352, 135, 181, 118,
+    75, 187, 74, 139, 259, 39, 177, 65, 345, 15, 308, 354, 90, 398, 398, 367, 367, 306, 42, 133,
+    341, 371, 341, 371, 138, 6, 127, 80, 42, 355, 131, 138, 157, 97, 146, 94, 352, 19, 120, 377,
+    401, 137, 89, 352, 21, 348, 131, 19, 66, 410, 89, 371, 398, 11, 32, 3, 250, 215, 250, 106,
+    215, 376, 69, 212, 316, 361, 131, 167, 121, 120, 212, 3, 200, 177, 225, 15, 377, 137, 339, 200,
+    250, 352, 371, 146, 212, 42, 326, 131, 148, 12, 396, 378, 94, 24, 105, 329, 371, 119, 345, 254,
+    135, 86, 326, 110, 386, 398, 84, 401, 306, 15, 409, 84, 112, 251, 16, 197, 59, 305, 165, 88,
+    334, 371, 39, 200, 121, 15, 189, 183, 133, 97, 251, 409, 137, 362, 387, 140, 97, 384, 138, 373,
+    365, 396, 302, 19, 19, 268, 302, 45, 384, 400, 170, 383, 50, 37, 300, 332, 247, 104, 354, 197,
+    138, 321, 94, 326, 51, 51, 398, 136, 393, 75, 142, 360, 48, 380, 11, 382, 170, 90, 26, 136,
+    305, 371, 404, 94, 106, 289, 386, 181, 371, 8, 37, 345, 398, 406, 17, 380, 389, 60, 383, 367,
+    258, 299, 345, 373, 142, 98, 354, 384, 15, 75, 308, 367, 300, 363, 187, 98, 384, 12, 396, 94,
+    378, 105, 24, 386, 354, 8, 393, 135, 398, 86, 326, 254, 16, 106, 401, 110, 84, 138, 13, 306,
+    334, 112, 165, 59, 200, 88, 121, 371, 387, 398, 137, 133, 409, 183, 189, 384, 409, 97, 142, 268,
+    396, 170, 302, 94, 75, 136, 308, 300, 50, 15, 400, 104, 247, 60, 170, 90, 406, 94, 404, 289,
+    386, 367, 383, 380, 389, 299, 373, 98, 39, 352, 302, 217, 336, 352, 38, 121, 38, 395, 353, 327,
+    411, 411, 177, 145, 94, 394, 98, 259, 299, 267, 372, 354, 409, 148, 265, 39, 50, 37, 37, 70,
+    146, 35, 66, 352, 392, 148, 379, 269, 136, 39, 42, 108, 364, 409, 333, 79, 182, 98, 323, 53,
+    352, 394, 319, 372, 146, 138, 271, 327, 49, 55, 189, 269, 61, 268, 409, 331, 269, 39, 132, 263,
+    263, 140, 385, 331, 84, 383, 383, 412, 242, 11, 161, 155, 78, 148, 94, 37, 138, 87, 398, 324,
+    379, 6, 259, 379, 262, 342, 325, 371, 226, 184, 202, 6, 70, 161, 342, 137, 50, 246, 260, 401,
+    146, 68, 398, 94, 244, 146, 299, 21, 225, 146, 177, 103, 371, 136, 79, 354, 140, 79, 401, 270,
+    162, 403, 112, 267, 166, 355, 39, 189, 251, 398, 137, 333, 24, 138, 58, 263, 15, 354, 79, 136,
+    146, 136, 308, 338, 42, 143, 229, 356, 22, 364, 56, 214, 308, 180, 375, 140, 41, 263, 213, 324,
+    138, 259, 350, 347, 49, 141, 136, 229, 146, 229, 192, 189, 176, 130, 146, 39, 345, 270, 331, 21,
+    412, 264, 371, 53, 410, 24, 410, 249, 398, 397, 68, 398, 377, 79, 78, 45, 375, 399, 66, 390,
+    37, 44, 138, 108, 327, 146, 94, 412, 70, 251, 281, 239, 331, 31, 340, 138, 62, 57, 259, 324,
+    262, 226, 68, 331, 136, 229, 244, 185, 383, 15, 40, 189, 181, 53, 327, 59, 319, 352, 166, 136,
+    398, 262, 66, 244, 410, 179, 14, 385, 226, 18, 340, 146, 65, 30, 354, 86, 42, 399, 78, 21,
+    53, 53, 148, 148, 183, 324, 263, 148, 258, 181, 78, 54, 110, 385, 58, 15, 15, 401, 146, 42,
+    263, 78, 41, 136, 351, 379, 226, 183, 182, 398, 177, 398, 33, 42, 76, 347, 187, 183, 354, 347,
+    413, 171, 357, 274, 288, 229, 324, 269, 136, 54, 57, 352, 166, 148, 183, 304, 105, 60, 89, 269,
+    331, 79, 79, 105, 172, 277, 194, 2, 136, 146, 327, 159, 173, 367, 202, 153, 269, 188, 173, 79,
+    398, 367, 331, 62, 373, 377, 36, 366, 112, 149, 347, 379, 358, 59, 363, 86, 277, 299, 165, 308,
+    341, 37, 59, 80, 215, 259, 200, 284, 165, 261, 404, 126, 128, 269, 165, 66, 184, 59, 5, 396,
+    86, 165, 368, 249, 12, 107, 107, 246, 401, 280, 80, 6, 400, 398, 369, 155, 371, 398, 306, 255,
+    84, 105, 146, 140, 111, 189, 151, 270, 400, 382, 398, 302, 180, 377, 301, 376, 345, 372, 395, 345,
+    94, 266, 400, 225, 176, 395, 392, 180, 409, 133, 346, 49, 114, 152, 371, 249, 261, 113, 226, 255,
+    110, 12, 192, 243, 180, 284, 281, 136, 368, 354, 45, 52, 48, 101, 376, 126, 308, 94, 409, 94,
+    348, 13, 392, 377, 348, 328, 107, 396, 353, 378, 189, 140, 35, 404, 347, 134, 364, 395, 140, 392,
+    22, 173, 89, 86, 183, 101, 294, 152, 131, 371, 136, 406, 84, 377, 138, 126, 175, 247, 177, 177,
+    189, 183, 36, 366, 112, 363, 59, 277, 404, 80, 192, 284, 126, 107, 155, 189, 400, 398, 371, 128,
+    396, 177, 369, 266, 306, 382, 398, 140, 400, 270, 189, 140, 395, 94, 180, 226, 12, 133, 113, 346,
+    180, 49, 409, 52, 94, 136, 348, 308, 247, 378, 353, 392, 189, 395, 183, 358, 107, 50, 50, 250,
+    414, 16, 169, 169, 50, 364, 9, 16, 16, 16, 364, 16, 9, 50, 16, 16, 37, 282, 233, 233,
+    33, 49, 49, 371, 278, 16, 16, 306, 377, 181, 58, 33, 98, 261, 377, 377, 259, 365, 371, 114,
+    197, 259, 381, 346, 338, 407, 373, 58, 380, 142, 119, 366, 86, 351, 58, 80, 117, 395, 58, 142,
+    378, 347, 179, 39, 36, 225, 333, 398, 371, 144, 137, 37, 59, 84, 66, 256, 401, 70, 386, 328,
+    308, 342, 269, 143, 133, 73, 376, 205, 14, 136, 216, 371, 141, 406, 182, 365, 340, 317, 306, 328,
+    245, 127, 225, 78, 144, 363, 365, 22, 376, 356, 268, 337, 401, 268, 66, 66, 338, 143, 331, 74,
+    371, 395, 336, 111, 351, 306, 38, 319, 385, 272, 90, 179, 323, 133, 177, 107, 170, 13, 57, 148,
+    14, 131, 59, 189, 376, 400, 142, 377, 49, 166, 347, 331, 371, 58, 378, 194, 15, 239, 377, 61,
+    321, 78, 321, 367, 45, 39, 331, 377, 306, 396, 376, 380, 80, 16, 114, 80, 353, 132, 268, 62,
+    58, 347, 217, 371, 106, 369, 41, 185, 365, 324, 66, 39, 378, 319, 324, 261, 196, 369, 110, 393,
+    5, 306, 23, 39, 319, 385, 395, 78, 66, 188, 39, 57, 183, 415, 275, 261, 363, 377, 371, 80,
+    181, 146, 306, 15, 369, 197, 357, 321, 117, 392, 330, 84, 207, 16, 16, 169, 177, 378, 369, 194,
+    177, 371, 335, 65, 259, 375, 299, 118, 377, 199, 282, 267, 352, 165, 94, 153, 19, 87, 359, 215,
+    358, 304, 10, 378, 56, 135, 357, 10, 351, 146, 376, 118, 325, 268, 15, 250, 20, 301, 12, 343,
+    66, 411, 370, 183, 165, 112, 401, 306, 161, 377, 97, 121, 264, 398, 136, 131, 127, 359, 140, 352,
+    112, 239, 172, 137, 163, 397, 172, 380, 367, 38, 74, 352, 189, 94, 351, 94, 100, 120, 172, 137,
+    104, 149, 373, 21, 352, 12, 177, 380, 22, 356, 259, 250, 266, 114, 400, 326, 411, 255, 170, 225,
+    37, 376, 22, 355, 60, 146, 375, 263, 371, 74, 367, 202, 287, 12, 80, 308, 147, 377, 380, 127,
+    166, 355, 355, 318, 327, 210, 352, 282, 42, 409, 411, 370, 351, 355, 380, 120, 375, 15, 200, 35,
+    94, 181, 372, 404, 128, 263, 367, 393, 198, 263, 362, 65, 15, 365, 15, 389, 347, 397, 200, 299,
+    183, 256, 60, 204, 370, 27, 163, 90, 204, 411, 165, 179, 383, 33, 376, 136, 367, 33, 383, 184,
+    131, 352, 90, 383, 177, 376, 71, 268, 408, 247, 400, 371, 98, 377, 145, 367, 414, 200, 396, 362,
+    74, 396, 89, 378, 94, 380, 325, 332, 260, 342, 416, 118, 107, 319, 256, 41, 382, 210, 173, 49,
+    41, 376, 336, 398, 354, 139, 38, 372, 338, 140, 202, 161, 320, 175, 258, 414, 117, 367, 306, 227,
+    347, 189, 171, 367, 328, 247, 392, 48, 326, 414, 406, 53, 167, 331, 354, 75, 128, 362, 359, 326,
+    268, 48, 380, 256, 155, 318, 205, 270, 41, 57, 380, 375, 4, 390, 117, 327, 139, 252, 37, 377,
+    177, 385, 173, 371, 139, 22, 140, 352, 326, 85, 233, 371, 177, 146, 367, 371, 227, 282, 365, 41,
+    367, 184, 205, 205, 227, 358, 140, 298, 205, 367, 16, 24, 306, 376, 306, 306, 177, 399, 370, 180,
+    352, 142, 142, 95, 371, 181, 62, 394, 71, 256, 268, 6, 94, 396, 398, 6, 190, 94, 216, 69,
+    299, 263, 160, 45, 409, 86, 129, 129, 118, 99, 259, 199, 279, 66, 316, 352, 371, 32, 306, 338,
+    352, 235, 261, 268, 138, 250, 370, 142, 6, 87, 37, 359, 74, 379, 261, 94, 22, 215, 358, 80,
+    148, 78, 106, 372, 261, 9, 288, 277, 35, 232, 89, 380, 371, 265, 250, 114, 126, 372, 149, 69,
+    371, 399, 352, 97, 279, 135, 325, 153, 378, 189, 80, 265, 79, 409, 225, 338, 306, 209, 107, 155,
+    184, 20, 316, 107, 21, 250, 377, 316, 416, 22, 376, 332, 137, 396, 306, 306, 398, 146, 33, 306,
+    306, 363, 394, 11, 121, 15, 305, 42, 306, 21, 401, 39, 381, 256, 336, 261, 94, 391, 200, 261,
+    94, 177, 379, 250, 368, 9, 21, 141, 106, 308, 397, 214, 352, 352, 66, 137, 214, 326, 131, 371,
+    316, 165, 150, 12, 138, 336, 359, 126, 140, 39, 84, 101, 20, 306, 213, 137, 372, 149, 400, 40,
+    355, 336, 212, 175, 136, 377, 362, 277, 415, 398, 267, 299, 39, 354, 359, 270, 250, 334, 401, 355,
+    210, 162, 369, 354, 354, 361, 149, 31, 173, 136, 250, 282, 205, 371, 372, 111, 3, 72, 376, 294,
+    154, 261, 190, 316, 2, 69, 118, 285, 306, 158, 268, 356, 395, 361, 384, 331, 57, 108, 126, 399,
+    337, 189, 202, 172, 345, 358, 380, 12, 351, 319, 377, 33, 71, 21, 118, 137, 126, 54, 90, 33,
+    345, 398, 316, 363, 129, 377, 333, 165, 408, 191, 359, 265, 304, 118, 191, 370, 42, 389, 146, 354,
+    80, 199, 258, 177, 244, 285, 38, 100, 177, 329, 20, 401, 396, 338, 185, 414, 146, 34, 378, 138,
+    99, 69, 328, 34, 192, 114, 184, 250, 189, 177, 262, 257, 147, 209, 414, 249, 3, 250, 354, 366,
+    406, 175, 1, 159, 324, 167, 75, 221, 47, 409, 397, 13, 229, 410, 48, 326, 71, 259, 261, 406,
+    136, 377, 142, 110, 200, 34, 332, 352, 179, 328, 107, 57, 308, 396, 189, 204, 189, 129, 17, 95,
+    170, 157, 87, 351, 216, 345, 383, 128, 63, 354, 251, 135, 180, 85, 203, 151, 373, 66, 179, 114,
+    354, 75, 338, 347, 410, 94, 281, 136, 80, 149, 37, 331, 390, 128, 368, 76, 353, 377, 158, 305,
+    132, 347, 94, 394, 31, 264, 306, 126, 166, 332, 213, 263, 263, 127, 337, 51, 131, 370, 209, 138,
+    76, 138, 317, 166, 128, 363, 395, 141, 396, 16, 399, 409, 361, 370, 202, 243, 2, 141, 261, 202,
+    323, 58, 10, 353, 179, 323, 151, 185, 369, 370, 234, 349, 280, 327, 323, 262, 177, 315, 47, 21,
+    244, 58, 15, 291, 99, 409, 351, 373, 132, 333, 185, 151, 322, 297, 318, 345, 120, 396, 396, 172,
+    371, 378, 327, 229, 352, 137, 101, 196, 147, 317, 412, 323, 353, 90, 348, 215, 189, 323, 241, 412,
+    339, 361, 110, 363, 179, 307, 5, 198, 212, 194, 15, 347, 185, 66, 290, 410, 371, 189, 5, 158,
+    262, 55, 259, 34, 327, 198, 375, 33, 90, 143, 17, 308, 188, 361, 51, 187, 383, 138, 27, 177,
+    353, 352, 153, 312, 14, 393, 261, 38, 189, 129, 136, 258, 133, 262, 256, 183, 294, 361, 290, 38,
+    166, 316, 185, 219, 132, 253, 321, 86, 263, 270, 368, 327, 355, 148, 140, 415, 181, 264, 173, 77,
+    358, 383, 136, 138, 399, 65, 366, 373, 77, 148, 234, 383, 258, 334, 86, 38, 71, 299, 151, 138,
+    88, 321, 189, 147, 133, 377, 179, 408, 263, 138, 408, 175, 15, 334, 131, 370, 79, 114, 61, 146,
+    89, 58, 12, 371, 2, 410, 365, 69, 401, 124, 406, 136, 229, 121, 135, 266, 19, 373, 166, 231,
+    362, 138, 138, 261, 31, 398, 208, 177, 175, 136, 413, 165, 300, 249, 169, 75, 315, 49, 189, 17,
+    11, 189, 354, 164, 187, 80, 189, 358, 138, 171, 21, 138, 369, 33, 355, 138, 352, 110, 26, 229,
+    175, 54, 269, 244, 194, 413, 190, 385, 229, 148, 327, 401, 171, 142, 95, 371, 396, 71, 394, 256,
+    181, 338, 261, 45, 299, 288, 86, 69, 203, 235, 368, 32, 359, 97, 22, 325, 146, 78, 35, 399,
+    215, 12, 99, 9, 261, 369, 265, 149, 351, 106, 153, 87, 135, 74, 232, 6, 377, 261, 397, 261,
+    107, 21, 155, 256, 22, 21, 379, 413, 214, 326, 137, 68, 376, 334, 21, 184, 315, 261, 200, 11,
+    306, 363, 324, 15, 225, 250, 79, 359, 154, 173, 84, 199, 366, 376, 38, 137, 370, 219, 398, 61,
+    336, 189, 69, 372, 151, 390, 401, 352, 335, 72, 354, 129, 270, 297, 116, 69, 101, 210, 397, 294,
+    140, 371, 33, 40, 327, 3, 372, 282, 401, 173, 258, 351, 170, 329, 179, 158, 356, 323, 177, 389,
+    42, 114, 100, 80, 361, 57, 191, 90, 358, 185, 151, 138, 285, 331, 172, 265, 146, 1, 262, 395,
+    239, 57, 200, 13, 259, 63, 155, 167, 34, 352, 107, 194, 47, 406, 142, 398, 354, 147, 135, 247,
+    326, 71, 138, 146, 204, 409, 264, 373, 151, 262, 316, 80, 31, 263, 399, 76, 318, 132, 131, 2,
+    75, 202, 188, 409, 88, 202, 212, 396, 21, 101, 229, 327, 147, 229, 215, 185, 100, 10, 371, 137,
+    19, 280, 17, 327, 198, 194, 14, 375, 143, 66, 412, 363, 185, 33, 148, 181, 258, 189, 78, 171,
+    258, 54, 262, 65, 135, 175, 131, 408, 179, 371, 31, 17, 169, 33, 355, 393, 34, 145, 5, 70,
+    269, 181, 205, 393, 203, 196, 311, 299, 135, 203, 367, 15, 118, 15, 299, 151, 153, 14, 126, 286,
+    290, 354, 354, 138, 209, 353, 313, 74, 390, 219, 392, 249, 353, 184, 16, 15, 286, 2, 110, 101,
+    101, 85, 42, 126, 112, 209, 294, 167, 172, 189, 335, 297, 146, 379, 379, 33, 269, 183, 34, 298,
+    167, 367, 348, 367, 80, 134, 377, 348, 126, 11, 126, 269, 369, 348, 9, 3, 347, 372, 168, 271,
+    171, 75, 270, 90, 332, 229, 324, 151, 121, 271, 46, 110, 74, 259, 166, 327, 110, 252, 152, 352,
+    133, 33, 250, 61, 131, 324, 348, 324, 203, 311, 299, 367, 118, 15, 348, 46, 286, 347, 354, 126,
+    138, 209, 153, 203, 390, 219, 112, 348, 324, 209, 189, 151, 85, 101, 121, 167, 145, 379, 172, 75,
+    377, 367, 34, 352, 348, 134, 367, 367, 33, 171, 269, 133, 168, 271, 121, 332, 324, 271, 152, 131,
+    94, 94, 174, 77, 358, 261, 351, 97, 398, 372, 368, 74, 80, 305, 9, 247, 158, 380, 284, 398,
+    250, 143, 87, 368, 372, 396, 141, 38, 80, 269, 66, 412, 416, 68, 184, 1, 342, 342, 250, 20,
+    94, 136, 189, 187, 37, 359, 79, 188, 212, 139, 308, 79, 354, 84, 112, 377, 97, 299, 149, 263,
+    359, 48, 94, 15, 353, 299, 305, 398, 258, 74, 378, 396, 42, 354, 62, 229, 380, 354, 247, 88,
+    411, 371, 77, 192, 372, 146, 47, 37, 250, 184, 328, 354, 189, 305, 354, 372, 401, 368, 278, 353,
+    40, 367, 372, 308, 66, 377, 187, 347, 347, 229, 77, 321, 3, 132, 141, 321, 372, 97, 367, 133,
+    101, 380, 351, 347, 2, 352, 327, 136, 393, 62, 5, 352, 372, 288, 275, 183, 340, 65, 140, 321,
+    321, 5, 354, 89, 225, 84, 136, 62, 352, 372, 398, 133, 187, 352, 177, 177, 177, 406, 121, 398,
+    322, 147, 217, 371, 271, 367, 265, 261, 360, 366, 136, 107, 131, 398, 106, 147, 50, 375, 146, 42,
+    128, 381, 194, 377, 41, 69, 321, 118, 350, 312, 110, 42, 381, 375, 136, 352, 41, 185, 177, 217,
+    364, 381, 136, 136, 377, 377, 364, 215, 93, 294, 214, 348, 89, 245, 380, 177, 39, 368, 184, 175,
+    3, 11, 351, 68, 61, 128, 351, 69, 362, 136, 214, 37, 356, 390, 335, 396, 247, 202, 184, 259,
+    400, 135, 297, 88, 126, 392, 372, 225, 401, 341, 183, 184, 73, 373, 351, 184, 312, 184, 353, 126,
+    372, 197, 197, 380, 185, 204, 19, 351, 347, 168, 372, 352, 371, 2, 60, 330, 354, 377, 189, 187,
+    59, 136, 245, 368, 6, 250, 347, 90, 352, 136, 197, 204, 204, 175, 177, 135, 2, 88, 59, 187,
+    184, 2, 90, 177, 11, 121, 121, 121, 20, 266, 266, 143, 332, 396, 143, 38, 266, 143, 143, 68,
+    143, 332, 88, 88, 154, 205, 206, 206, 11, 370, 332, 133, 370, 101, 71, 31, 261, 277, 66, 75,
+    351, 277, 265, 142, 364, 232, 6, 372, 288, 215, 212, 412, 58, 9, 371, 369, 328, 12, 141, 126,
+    246, 368, 20, 372, 101, 328, 141, 357, 3, 3, 123, 105, 260, 58, 263, 335, 198, 373, 321, 333,
+    263, 363, 159, 14, 324, 300, 20, 168, 146, 169, 357, 281, 10, 83, 268, 268, 121, 263, 214, 146,
+    138, 16, 66, 138, 348, 328, 106, 324, 12, 357, 244, 101, 15, 168, 327, 188, 112, 263, 364, 136,
+    138, 139, 33, 58, 128, 354, 261, 75, 343, 138, 171, 347, 277, 94, 202, 270, 101, 347, 263, 118,
+    34, 168, 281, 380, 302, 347, 101, 8, 328, 106, 380, 100, 15, 347, 321, 75, 343, 75, 347, 277,
+    94, 118, 347, 380, 328, 145, 145, 354, 357, 354, 136, 372, 381, 380, 301, 174, 249, 132, 373, 380,
+    249, 3, 372, 355, 128, 370, 71, 266, 166, 355, 314, 118, 362, 371, 362, 80, 317, 166, 259, 119,
+    377, 345, 9, 78, 66, 60, 244, 256, 184, 36, 143, 175, 121, 263, 80, 80, 347, 357, 168, 304,
+    371, 371, 117, 77, 377, 255, 175, 94, 137, 337, 133, 166, 137, 194, 335, 38, 373, 380, 128, 118,
+    143, 340, 340, 254, 170, 340, 409, 409, 47, 71, 170, 326, 118, 261, 155, 55, 363, 265, 371, 289,
+    331, 80, 80, 367, 348, 152, 375, 404, 367, 354, 358, 371, 378, 291, 68, 68, 139, 166, 175, 173,
+    252, 344, 198, 53, 369, 120, 263, 107, 365, 367, 133, 33, 282, 204, 19, 354, 254, 189, 171, 229,
+    270, 370, 71, 266, 118, 355, 314, 362, 362, 345, 107, 78, 259, 9, 317, 119, 377, 189, 184, 256,
+    143, 141, 137, 335, 121, 373, 144, 155, 371, 254, 133, 340, 118, 373, 373, 155, 331, 375, 80, 404,
+    367, 80, 229, 198, 68, 291, 120, 175, 33, 282, 254, 270, 90, 17, 108, 94, 353, 392, 17, 288,
+    6, 325, 182, 108, 363, 301, 146, 17, 316, 347, 368, 369, 318, 151, 318, 86, 185, 352, 185, 252,
+    252, 185, 17, 17, 17, 181, 17, 294, 90, 361, 90, 368, 392, 17, 288, 146, 316, 318, 369, 185,
+    252, 17, 17, 88, 86, 88, 88, 306, 306, 25, 136, 71, 316, 342, 392, 322, 355, 341, 277, 377,
+    147, 39, 372, 86, 86, 322, 372, 337, 371, 416, 15, 141, 328, 11, 50, 334, 316, 11, 306, 79,
+    117, 277, 332, 140, 137, 20, 369, 336, 50, 355, 368, 147, 84, 367, 174, 352, 25, 21, 221, 80,
+    22, 149, 74, 319, 377, 306, 369, 134, 114, 306, 138, 406, 20, 354, 22, 370, 326, 88, 393, 347,
+    110, 80, 236, 380, 128, 132, 334, 133, 138, 127, 2, 327, 89, 347, 107, 31, 317, 327, 21, 100,
+    352, 166, 185, 318, 328, 370, 348, 212, 327, 198, 15, 377, 361, 142, 290, 166, 404, 299, 39, 60,
+    371, 136, 275, 38, 375, 328, 347, 355, 392, 89, 117, 204, 367, 212, 33, 355, 194, 383, 218, 306,
+    71, 136, 342, 359, 341, 352, 277, 377, 39, 86, 372, 138, 306, 11, 316, 79, 371, 84, 275, 355,
+    121, 174, 140, 352, 20, 21, 74, 80, 377, 221, 149, 114, 134, 354, 110, 31, 166, 107, 318, 33,
+    370, 212, 21, 185, 361, 142, 198, 290, 404, 218, 307, 166, 114, 355, 89, 21, 225, 15, 21, 338,
+    118, 88, 138, 3, 2, 94, 354, 380, 358, 89, 254, 358, 196, 377, 90, 118, 66, 342, 395, 39,
+    365, 401, 398, 247, 358, 279, 288, 380, 348, 398, 60, 189, 376, 21, 11, 148, 342, 371, 269, 348,
+    269, 144, 256, 394, 378, 247, 400, 146, 401, 235, 146, 250, 384, 137, 184, 396, 325, 94, 368, 306,
+    15, 342, 342, 316, 185, 196, 251, 328, 398, 280, 330, 73, 365, 270, 304, 144, 84, 117, 21, 401,
+    372, 194, 400, 60, 117, 185, 146, 317, 265, 199, 172, 118, 338, 363, 340, 149, 80, 38, 359, 2,
+    189, 406, 400, 302, 251, 167, 328, 170, 410, 155, 259, 259, 367, 88, 292, 367, 101, 369, 351, 251,
+    51, 251, 261, 88, 132, 261, 135, 377, 331, 270, 353, 410, 166, 281, 316, 108, 342, 112, 318, 261,
+    38, 398, 185, 249, 330, 352, 27, 75, 367, 378, 411, 292, 299, 259, 398, 312, 189, 352, 194, 393,
+    212, 5, 25, 17, 51, 269, 15, 398, 377, 362, 129, 21, 319, 356, 183, 392, 78, 185, 342, 30,
+    68, 140, 334, 367, 194, 392, 143, 371, 370, 342, 254, 400, 367, 187, 189, 330, 355, 136, 312, 146,
+    352, 131, 177, 17, 196, 377, 342, 365, 39, 269, 279, 21, 189, 384, 306, 316, 94, 146, 411, 401,
+    342, 235, 137, 371, 59, 356, 196, 372, 140, 129, 194, 117, 251, 17, 177, 38, 367, 359, 265, 149,
+    259, 259, 155, 406, 410, 319, 25, 251, 398, 166, 292, 351, 5, 185, 261, 299, 17, 194, 51, 33,
+    400, 136, 312, 355, 107, 347, 347, 347, 377, 98, 371, 4, 337, 141, 11, 12, 50, 331, 66, 161,
+    117, 263, 127, 162, 101, 340, 104, 251, 15, 155, 260, 377, 321, 188, 21, 356, 10, 21, 50, 164,
+    19, 212, 181, 188, 356, 75, 384, 321, 331, 19, 164, 189, 100, 100, 263, 154, 263, 173, 292, 17,
+    167, 167, 66, 87, 361, 273, 200, 60, 167, 19, 85, 333, 250, 409, 85, 273, 331, 11, 15, 200,
+    94, 84, 280, 269, 105, 361, 168, 136, 249, 402, 301, 323, 331, 177, 19, 410, 66, 249, 317, 397,
+    270, 410, 314, 138, 342, 128, 169, 145, 259, 179, 396, 19, 249, 196, 290, 198, 198, 296, 362, 182,
+    261, 261, 218, 131, 168, 231, 19, 182, 274, 74, 74, 219, 126, 352, 74, 118, 74, 74, 145, 34,
+    377, 377, 101, 367, 94, 265, 112, 410, 185, 112, 300, 377, 112, 202, 136, 259, 95, 166, 134, 6,
+    256, 202, 362, 367, 356, 180, 377, 340, 259, 346, 180, 347, 98, 39, 252, 15, 212, 136, 362, 41,
+    367, 392, 377, 62, 277, 141, 6, 126, 342, 69, 136, 362, 80, 80, 297, 119, 341, 212, 141, 304,
+    9, 378, 250, 189, 348, 128, 189, 381, 87, 89, 215, 376, 251, 212, 121, 353, 269, 118, 250, 184,
+    342, 21, 268, 255, 94, 15, 50, 347, 146, 69, 6, 376, 113, 250, 226, 359, 325, 11, 94, 390,
+    146, 107, 306, 73, 59, 324, 141, 308, 127, 355, 84, 3, 347, 394, 401, 372, 182, 194, 336, 331,
+    371, 20, 347, 140, 161, 112, 354, 101, 133, 173, 94, 154, 361, 79, 149, 331, 206, 301, 390, 323,
+    265, 377, 221, 395, 113, 104, 319, 351, 268, 299, 258, 131, 333, 177, 297, 297, 154, 204, 38, 177,
+    411, 352, 375, 304, 409, 259, 397, 355, 221, 48, 136, 69, 264, 107, 400, 73, 170, 88, 225, 371,
+    167, 189, 145, 34, 143, 192, 184, 411, 177, 204, 410, 398, 226, 128, 377, 66, 306, 304, 131, 331,
+    127, 359, 401, 169, 410, 387, 16, 16, 131, 270, 387, 347, 347, 377, 48, 281, 70, 132, 179, 367,
+    268, 268, 138, 15, 80, 368, 94, 289, 98, 353, 342, 128, 306, 287, 363, 348, 261, 120, 351, 87,
+    292, 185, 196, 306, 306, 110, 409, 330, 324, 369, 80, 375, 261, 259, 348, 287, 304, 179, 5, 174,
+    133, 209, 136, 333, 269, 138, 304, 198, 352, 268, 17, 136, 136, 401, 139, 361, 404, 375, 393, 153,
+    364, 18, 377, 269, 355, 21, 140, 365, 319, 132, 415, 299, 299, 86, 112, 183, 365, 207, 352, 389,
+    355, 89, 110, 127, 163, 387, 292, 392, 98, 112, 373, 177, 34, 175, 308, 2, 282, 136, 362, 128,
+    308, 177, 182, 177, 208, 396, 355, 80, 189, 110, 177, 354, 377, 62, 136, 376, 341, 189, 87, 6,
+    121, 6, 255, 226, 189, 376, 390, 94, 21, 11, 127, 250, 325, 112, 141, 154, 347, 84, 336, 387,
+    127, 163, 136, 140, 354, 390, 355, 365, 104, 177, 179, 138, 177, 306, 333, 113, 297, 131, 149, 136,
+    375, 266, 184, 259, 411, 88, 167, 34, 107, 225, 226, 69, 143, 304, 306, 409, 89, 70, 15, 34,
+    331, 348, 347, 289, 80, 268, 94, 132, 270, 139, 16, 292, 5, 259, 324, 110, 369, 245, 138, 174,
+    17, 364, 18, 198, 209, 375, 347, 352, 112, 299, 183, 415, 128, 98, 177, 392, 110, 228, 371, 94,
+    177, 145, 22, 367, 94, 69, 136, 90, 282, 98, 306, 90, 210, 11, 378, 398, 128, 265, 94, 9,
+    348, 138, 306, 377, 93, 369, 148, 148, 250, 131, 396, 11, 367, 366, 397, 87, 90, 348, 241, 59,
+    101, 282, 184, 208, 94, 342, 209, 177, 16, 398, 101, 378, 50, 269, 356, 39, 60, 146, 369, 107,
+    399, 377, 368, 377, 366, 334, 377, 332, 373, 77, 351, 84, 108, 2, 398, 367, 124, 356, 137, 182,
+    401, 368, 331, 126, 194, 282, 213, 101, 277, 140, 361, 400, 39, 194, 124, 226, 80, 190, 137, 136,
+    338, 131, 342, 22, 351, 147, 377, 21, 149, 149, 15, 352, 149, 146, 338, 143, 331, 80, 80, 165,
+    128, 351, 304, 170, 140, 244, 189, 250, 308, 94, 3, 408, 249, 265, 261, 12, 69, 189, 271, 138,
+    146, 338, 366, 378, 259, 177, 370, 406, 159, 79, 167, 305, 259, 143, 371, 371, 143, 409, 170, 73,
+    259, 48, 104, 146, 148, 371, 415, 136, 308, 373, 39, 207, 281, 3, 268, 331, 128, 331, 80, 141,
+    200, 94, 48, 338, 367, 121, 378, 251, 167, 202, 128, 373, 45, 351, 146, 73, 26, 87, 121, 373,
+    378, 354, 349, 306, 121, 42, 327, 353, 287, 185, 136, 107, 138, 322, 118, 50, 50, 371, 369, 367,
+    136, 177, 332, 160, 331, 331, 371, 338, 196, 356, 100, 332, 37, 136, 339, 395, 5, 369, 371, 241,
+    39, 398, 185, 375, 189, 15, 312, 408, 377, 351, 148, 372, 331, 316, 140, 371, 129, 15, 373, 319,
+    132, 86, 140, 181, 367, 100, 145, 354, 354, 338, 197, 415, 377, 373, 189, 339, 354, 364, 371, 250,
+    308, 194, 352, 371, 136, 386, 377, 392, 370, 368, 250, 231, 128, 205, 373, 204, 66, 379, 377, 175,
+    22, 189, 121, 187, 312, 379, 373, 110, 269, 177, 190, 228, 145, 136, 378, 210, 306, 241, 366, 26,
+    11, 396, 107, 73, 189, 366, 356, 368, 184, 39, 269, 378, 364, 342, 316, 398, 84, 108, 361, 124,
+    400, 101, 190, 126, 351, 21, 177, 147, 107, 80, 377, 354, 331, 351, 271, 207, 3, 167, 12, 249,
+    261, 48, 104, 378, 319, 128, 121, 80, 107, 268, 50, 202, 351, 371, 369, 349, 185, 136, 371, 138,
+    121, 371, 373, 395, 185, 181, 140, 145, 377, 189, 131, 392, 373, 128, 204, 110, 312, 189, 142, 184,
+    138, 354, 57, 138, 138, 367, 57, 189, 376, 53, 136, 246, 53, 246, 401, 149, 401, 138, 205, 205,
+    377, 185, 37, 149, 183, 225, 259, 189, 145, 149, 143, 177, 355, 354, 137, 205, 177, 302, 393, 183,
+    143, 259, 184, 367, 53, 197, 197, 121, 35, 94, 206, 206, 94, 246, 269, 269, 213, 94, 354, 170,
+    269, 206, 39, 90, 94, 269, 206, 196, 201, 212, 133, 212, 411, 238, 89, 132, 132, 142, 111, 332,
+    337, 126, 129, 165, 126, 308, 177, 226, 39, 122, 122, 371, 261, 60, 352, 341, 212, 212, 261, 59,
+    42, 376, 68, 371, 353, 367, 269, 202, 367, 266, 379, 177, 61, 75, 25, 367, 367, 367, 60, 3,
+    396, 59, 25, 371, 202, 392, 367, 75, 189, 398, 89, 94, 94, 206, 209, 378, 53, 269, 35, 343,
+    401, 398, 204, 5, 18, 342, 15, 378, 35, 342, 71, 205, 216, 71, 409, 107, 107, 73, 89, 328,
+    378, 250, 34, 100, 259, 378, 327, 330, 308, 308, 89, 88, 348, 6, 69, 342, 399, 269, 305, 306,
+    376, 306, 335, 351, 146, 143, 134, 146, 367, 338, 316, 352, 354, 367, 175, 15, 369, 268, 118, 351,
+    351, 127, 357, 80, 390, 361, 349, 390, 233, 218, 259, 391, 136, 409, 136, 136, 259, 136, 39, 37,
+    37, 121, 366, 372, 357, 11, 386, 357, 32, 39, 367, 146, 333, 184, 184, 42, 270, 357, 157, 229,
+    145, 369, 49, 380, 377, 42, 371, 225, 386, 411, 269, 380, 367, 241, 80, 350, 371, 50, 411, 68,
+    42, 142, 366, 39, 37, 121, 372, 146, 184, 11, 333, 409, 372, 377, 49, 269, 350, 187, 245, 105,
+    245, 367, 187, 187, 105, 152, 58, 184, 58, 187, 105, 152, 112, 268, 18, 112, 379, 47, 121, 148,
+    357, 377,
+};
+
+} // namespace
+
+const char *syllable(QChar c)
+{
+    ushort code = c.unicode();
+    if (code < FirstHanzi || code > LastHanzi) {
+        return nullptr;
+    }
+    ushort index = SyllableOf[code - FirstHanzi];
+    return index ? Syllables[index] : nullptr;
+}
+
+QString fullKey(const QString &text)
+{
+    QString key;
+    key.reserve(text.size() * 4);
+    for (QChar c : text) {
+        if (const char *s = syllable(c)) {
+            key += QLatin1String(s);
+        } else if (c.unicode() < 0x80 && c.isLetterOrNumber()) {
+            key += c.toLower();
+        }
+    }
+    return key;
+}
+
+QString initialsKey(const QString &text)
+{
+    QString key;
+    key.reserve(text.size());
+    for (QChar c : text) {
+        if (const char *s = syllable(c)) {
+            key += QLatin1Char(s[0]);
+        } else if (c.unicode() < 0x80 && c.isLetterOrNumber()) {
+            key += c.toLower();
+        }
+    }
+    return key;
+}
+
+} // namespace Pinyin
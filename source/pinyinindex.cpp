@@ -0,0 +1,155 @@
+#include "pinyinindex.h"
+#include "pinyin.h"
+#include <algorithm>
+
+void PinyinIndex::insert(quint32 doc, const QStringList &fields)
+{
+    remove(doc);
+
+    QStringList fieldKeys;
+    for (const QString &field : fields) {
+        for (const QString &key : {Pinyin::fullKey(field), Pinyin::initialsKey(field)}) {
+            if (!key.isEmpty() && !fieldKeys.contains(key)) {
+                fieldKeys.append(key);
+            }
+        }
+    }
+    if (fieldKeys.isEmpty()) {
+        return;
+    }
+
+    for (const QString &key : fieldKeys) {
+        keys[key].append(doc);
+    }
+    docKeys.insert(doc, fieldKeys);
+}
+
+void PinyinIndex::remove(quint32 doc)
+{
+    auto found = docKeys.find(doc);
+    if (found == docKeys.end()) {
+        return;
+    }
+
+    for (const QString &key : *found) {
+        auto it = keys.find(key);
+        if (it != keys.end()) {
+            it->removeOne(doc);
+            if (it->isEmpty()) {
+                keys.erase(it);
+            }
+        }
+    }
+    docKeys.erase(found);
+}
+
+void PinyinIndex::clear()
+{
+    keys.clear();
+    docKeys.clear();
+}
+
+int PinyinIndex::maxDistance(int length)
+{
+    // 首字母之类的短查询只做精确前缀匹配，否则几乎什么都能匹配上
+    if (length < 4) return 0;
+    if (length < 8) return 1;
+    return 2;
+}
+
+QVector<quint32> PinyinIndex::match(const QString &query) const
+{
+    QVector<quint32> docs;
+    const QString q = Pinyin::fullKey(query);
+    const int m = q.size();
+    if (m == 0) {
+        return docs;
+    }
+
+    const int d = maxDistance(m);
+    if (d == 0) {
+        collect(keys.lowerBound(q), prefixEnd(q), &docs);
+    } else {
+        // rows[j][i]：键的前 j 个字符与查询串前 i 个字符的编辑距离，path 为已计算的键前缀
+        QVector<QVector<int>> rows;
+        QVector<int> first(m + 1);
+        for (int i = 0; i <= m; ++i) {
+            first[i] = i;
+        }
+        rows.append(first);
+        QString path;
+
+        auto it = keys.constBegin();
+        while (it != keys.constEnd()) {
+            const QString &key = it.key();
+
+            // 与上一个键的公共前缀部分直接复用
+            int common = 0;
+            int limit = qMin(path.size(), key.size());
+            while (common < limit && path[common] == key[common]) {
+                ++common;
+            }
+            path.truncate(common);
+            rows.resize(common + 1);
+
+            bool matched = false;
+            bool pruned = false;
+            while (path.size() < key.size()) {
+                QChar c = key[path.size()];
+                QVector<int> row(m + 1);
+                {
+                    const QVector<int> &prev = rows.last();
+                    row[0] = prev[0] + 1;
+                    int best = row[0];
+                    for (int i = 1; i <= m; ++i) {
+                        int cost = (q[i - 1] == c) ? 0 : 1;
+                        row[i] = qMin(qMin(prev[i] + 1, row[i - 1] + 1), prev[i - 1] + cost);
+                        best = qMin(best, row[i]);
+                    }
+                    pruned = best > d;
+                }
+                path += c;
+                rows.append(row);
+
+                // 查询串已与 path 足够接近：以 path 开头的键全部匹配
+                if (row[m] <= d) {
+                    matched = true;
+                    break;
+                }
+                // 再往后只会更远：以 path 开头的键全部跳过
+                if (pruned) {
+                    break;
+                }
+            }
+
+            if (matched) {
+                auto end = prefixEnd(path);
+                collect(it, end, &docs);
+                it = end;
+            } else if (pruned) {
+                it = prefixEnd(path);
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    std::sort(docs.begin(), docs.end());
+    docs.erase(std::unique(docs.begin(), docs.end()), docs.end());
+    return docs;
+}
+
+void PinyinIndex::collect(QMap<QString, QVector<quint32>>::const_iterator begin,
+                          QMap<QString, QVector<quint32>>::const_iterator end,
+                          QVector<quint32> *docs) const
+{
+    for (auto it = begin; it != end; ++it) {
+        docs->append(*it);
+    }
+}
+
+// 第一个不以 prefix 开头的键（键只含 ASCII 字符）
+QMap<QString, QVector<quint32>>::const_iterator PinyinIndex::prefixEnd(const QString &prefix) const
+{
+    return keys.lowerBound(prefix + QChar(0xFFFF));
+}
@@ -0,0 +1,218 @@
+#include "popularitytracker.h"
+#include <algorithm>
+
+void PopularityRanking::add(IdPool::Handle key, int delta)
+{
+    auto it = entries.find(key);
+    if (it == entries.end()) {
+        if (delta <= 0) {
+            return;   // 没有被跟踪（或已被顶替）的键，它的次数已算在别的键里
+        }
+        Entry entry;
+        if (entries.size() >= Capacity) {
+            // 顶替次数最少的键（ordered 的最后一项）
+            auto last = ordered.end();
+            --last;
+            entry.error = last.value();
+            entries.remove(last.key().second);
+            ordered.erase(last);
+        }
+        entry.count = entry.error + delta;
+        insertEntry(key, entry);
+        return;
+    }
+
+    Entry entry = it.value();
+    ordered.remove(qMakePair(-entry.count, key));
+    entries.erase(it);
+    entry.count += delta;
+    entry.error = qMin(entry.error, entry.count);
+    if (entry.count > 0) {
+        insertEntry(key, entry);
+    }
+}
+
+void PopularityRanking::insertEntry(IdPool::Handle key, const Entry &entry)
+{
+    entries.insert(key, entry);
+    ordered.insert(qMakePair(-entry.count, key), entry.count);
+}
+
+QVector<QPair<QString, int>> PopularityRanking::top(int k) const
+{
+    QVector<QPair<QString, int>> result;
+    for (auto it = ordered.constBegin(); it != ordered.constEnd() && result.size() < k; ++it) {
+        result.append(qMakePair(IdPool::string(it.key().second), it.value()));
+    }
+    return result;
+}
+
+void PopularityRanking::clear()
+{
+    entries.clear();
+    ordered.clear();
+}
+
+int PopularityTracker::windowDays(Window window)
+{
+    switch (window) {
+    case Week: return 7;
+    case Month: return 30;
+    default: return 365;
+    }
+}
+
+void PopularityTracker::reset(const QDate &today)
+{
+    events.clear();
+    eventsByBook.clear();
+    categories.clear();
+    for (Counters &c : counters) {
+        c.books.clear();
+        c.readersByCategory.clear();
+        c.categories.clear();
+    }
+    lastDay = today.toJulianDay();
+}
+
+bool PopularityTracker::advanceTo(const QDate &today)
+{
+    qint64 newDay = today.toJulianDay();
+    if (newDay < lastDay) {
+        return false;
+    }
+    if (newDay == lastDay) {
+        return true;
+    }
+
+    for (int w = 0; w < WindowCount; ++w) {
+        qint64 days = windowDays(static_cast<Window>(w));
+        qint64 oldFirst = lastDay - days + 1;
+        qint64 newFirst = newDay - days + 1;
+        // 滑出窗口的日子扣除，滑入窗口的日子（之前记下的未来借阅）计入
+        apply(static_cast<Window>(w), oldFirst, qMin(newFirst - 1, lastDay), -1);
+        apply(static_cast<Window>(w), qMax(lastDay + 1, newFirst), newDay, 1);
+    }
+    lastDay = newDay;
+
+    // 已经不在最长窗口内的事件不再需要
+    qint64 keepFrom = lastDay - windowDays(Year) + 1;
+    while (!events.isEmpty() && events.firstKey() < keepFrom) {
+        for (const Event &event : events.first()) {
+            auto it = eventsByBook.find(event.book);
+            if (it == eventsByBook.end()) {
+                continue;   // 同一天同一本书的事件已经一起去掉了
+            }
+            QVector<BookEvent> &list = it.value();
+            auto kept = std::lower_bound(list.begin(), list.end(), keepFrom,
+                                         [](const BookEvent &e, qint64 day) { return e.day < day; });
+            list.erase(list.begin(), kept);
+            if (list.isEmpty()) {
+                eventsByBook.erase(it);
+            }
+        }
+        events.erase(events.begin());
+    }
+    return true;
+}
+
+void PopularityTracker::add(const QDate &borrowDate, IdPool::Handle book,
+                            int category, IdPool::Handle reader)
+{
+    if (!borrowDate.isValid()) {
+        return;
+    }
+    qint64 day = borrowDate.toJulianDay();
+    if (day <= lastDay - windowDays(Year)) {
+        return;
+    }
+
+    categories.insert(book, category);
+    Event event{book, reader};
+    events[day].append(event);
+    QVector<BookEvent> &list = eventsByBook[book];
+    auto pos = std::upper_bound(list.begin(), list.end(), day,
+                                [](qint64 d, const BookEvent &e) { return d < e.day; });
+    list.insert(pos, BookEvent{day, reader});
+    for (int w = 0; w < WindowCount; ++w) {
+        if (day <= lastDay && day > lastDay - windowDays(static_cast<Window>(w))) {
+            apply(counters[w], event, 1);
+        }
+    }
+}
+
+// 先按旧类别扣除该书在各窗口内的借阅，改类别后再按新类别计入，
+// 只遍历这本书一年内的借阅
+void PopularityTracker::setCategory(IdPool::Handle book, int category)
+{
+    auto it = categories.find(book);
+    if (it == categories.end() || it.value() == category) {
+        return;
+    }
+    applyBook(book, -1);
+    categories.insert(book, category);
+    applyBook(book, 1);
+}
+
+QVector<QPair<QString, int>> PopularityTracker::topBooks(Window window, int k) const
+{
+    return counters[window].books.top(k);
+}
+
+QVector<QPair<QString, int>> PopularityTracker::topReaders(Window window, int category, int k) const
+{
+    auto it = counters[window].readersByCategory.constFind(category);
+    return it != counters[window].readersByCategory.constEnd() ? it->top(k)
+                                                               : QVector<QPair<QString, int>>();
+}
+
+int PopularityTracker::categoryCount(Window window, int category) const
+{
+    return counters[window].categories.value(category);
+}
+
+// 对借阅日在 [from, to] 内的全部事件调整窗口计数
+void PopularityTracker::apply(Window window, qint64 from, qint64 to, int delta)
+{
+    if (from > to) {
+        return;
+    }
+    auto end = events.upperBound(to);
+    for (auto it = events.lowerBound(from); it != end; ++it) {
+        for (const Event &event : *it) {
+            apply(counters[window], event, delta);
+        }
+    }
+}
+
+void PopularityTracker::apply(Counters &c, const Event &event, int delta)
+{
+    c.books.add(event.book, delta);
+    applyCategory(c, categories.value(event.book), event.reader, delta);
+}
+
+void PopularityTracker::applyCategory(Counters &c, int category, IdPool::Handle reader, int delta)
+{
+    c.readersByCategory[category].add(reader, delta);
+    int &count = c.categories[category];
+    count += delta;
+    if (count <= 0) {
+        c.categories.remove(category);
+    }
+}
+
+// 只调整 book 的类别计数和读者计数，图书计数不变
+void PopularityTracker::applyBook(IdPool::Handle book, int delta)
+{
+    int category = categories.value(book);
+    for (const BookEvent &e : eventsByBook.value(book)) {
+        if (e.day > lastDay) {
+            break;   // 之后的都是还没进入窗口的未来借阅
+        }
+        for (int w = 0; w < WindowCount; ++w) {
+            if (e.day > lastDay - windowDays(static_cast<Window>(w))) {
+                applyCategory(counters[w], category, e.reader, delta);
+            }
+        }
+    }
+}
@@ -0,0 +1,48 @@
+#include "prefixindex.h"
+
+QString PrefixIndex::normalize(const QString &text)
+{
+    QString normalized = text.simplified();
+    for (QChar &c : normalized) {
+        c = c.toCaseFolded();
+    }
+    return normalized;
+}
+
+void PrefixIndex::insert(const QString &text)
+{
+    QString key = normalize(text);
+    if (key.isEmpty()) {
+        return;
+    }
+
+    auto it = entries.find(key);
+    if (it != entries.end()) {
+        it->refs++;
+    } else {
+        entries.insert(key, Entry{text.simplified(), 1});
+    }
+}
+
+void PrefixIndex::remove(const QString &text)
+{
+    auto it = entries.find(normalize(text));
+    if (it != entries.end() && --it->refs <= 0) {
+        entries.erase(it);
+    }
+}
+
+QStringList PrefixIndex::complete(const QString &prefix, int limit) const
+{
+    QStringList result;
+    QString key = normalize(prefix);
+    if (key.isEmpty() || limit <= 0) {
+        return result;
+    }
+
+    for (auto it = entries.lowerBound(key);
+         it != entries.constEnd() && result.size() < limit && it.key().startsWith(key); ++it) {
+        result.append(it->text);
+    }
+    return result;
+}
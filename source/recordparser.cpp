@@ -0,0 +1,106 @@
+#include "recordparser.h"
+#include <climits>
+#include <cstring>
+
+namespace RecordParser {
+
+namespace {
+
+inline bool isDigit(char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+inline int digitsAt(const char *p, int count)
+{
+    int value = 0;
+    for (int i = 0; i < count; ++i) {
+        if (!isDigit(p[i])) {
+            return -1;
+        }
+        value = value * 10 + (p[i] - '0');
+    }
+    return value;
+}
+
+} // namespace
+
+int split(const char *line, int length, Field *fields, int maxFields)
+{
+    const char *p = line;
+    const char *end = line + length;
+    int count = 0;
+
+    while (count < maxFields) {
+        const char *comma = static_cast<const char *>(std::memchr(p, ',', end - p));
+        const char *fieldEnd = comma ? comma : end;
+        fields[count].data = p;
+        fields[count].size = static_cast<int>(fieldEnd - p);
+        ++count;
+        if (!comma) {
+            break;
+        }
+        p = comma + 1;
+    }
+    return count;
+}
+
+QString toString(const Field &field)
+{
+    return QString::fromUtf8(field.data, field.size);
+}
+
+int toInt(const Field &field)
+{
+    const char *p = field.data;
+    const char *end = field.data + field.size;
+    while (p < end && *p == ' ') ++p;
+    while (end > p && end[-1] == ' ') --end;
+
+    bool negative = false;
+    if (p < end && (*p == '-' || *p == '+')) {
+        negative = (*p == '-');
+        ++p;
+    }
+    if (p == end) {
+        return 0;
+    }
+
+    qint64 value = 0;
+    for (; p < end; ++p) {
+        if (!isDigit(*p)) {
+            return 0;
+        }
+        value = value * 10 + (*p - '0');
+        if (value > INT_MAX) {
+            return 0;
+        }
+    }
+    return static_cast<int>(negative ? -value : value);
+}
+
+QDate toDate(const Field &field)
+{
+    const char *p = field.data;
+    if (field.size != 10 || p[4] != '-' || p[7] != '-') {
+        return QDate();
+    }
+
+    int year = digitsAt(p, 4);
+    int month = digitsAt(p + 5, 2);
+    int day = digitsAt(p + 8, 2);
+    if (year < 0 || month < 0 || day < 0) {
+        return QDate();
+    }
+
+    // 月、日超出范围时 QDate 构造出的是无效日期，与 QDate::fromString 一致
+    return QDate(year, month, day);
+}
+
+bool equals(const Field &field, const char *text)
+{
+    int length = static_cast<int>(std::strlen(text));
+    return field.size == length && std::memcmp(field.data, text, length) == 0;
+}
+
+} // namespace RecordParser
@@ -0,0 +1,140 @@
+#include "reservationqueue.h"
+
+ReservationQueue::Handle ReservationQueue::enqueue(IdPool::Handle reader, IdPool::Handle book)
+{
+    Handle handle;
+    if (!freeNodes.isEmpty()) {
+        handle = freeNodes.takeLast();
+    } else {
+        handle = static_cast<Handle>(nodes.size());
+        nodes.append(Node());
+    }
+
+    Node &node = nodes[handle];
+    node.reader = reader;
+    node.book = book;
+    node.used = true;
+
+    append(byBook[node.book], handle, &Node::prevByBook, &Node::nextByBook);
+    append(byReader[node.reader], handle, &Node::prevByReader, &Node::nextByReader);
+    append(all, handle, &Node::prev, &Node::next);
+    return handle;
+}
+
+bool ReservationQueue::cancel(Handle handle)
+{
+    if (handle >= static_cast<Handle>(nodes.size()) || !nodes[handle].used) {
+        return false;
+    }
+
+    Node &node = nodes[handle];
+    auto book = byBook.find(node.book);
+    unlink(*book, handle, &Node::prevByBook, &Node::nextByBook);
+    if (book->count == 0) {
+        byBook.erase(book);
+    }
+    auto reader = byReader.find(node.reader);
+    unlink(*reader, handle, &Node::prevByReader, &Node::nextByReader);
+    if (reader->count == 0) {
+        byReader.erase(reader);
+    }
+    unlink(all, handle, &Node::prev, &Node::next);
+
+    node.used = false;
+    freeNodes.append(handle);
+    return true;
+}
+
+void ReservationQueue::clear()
+{
+    nodes.clear();
+    freeNodes.clear();
+    byBook.clear();
+    byReader.clear();
+    all = Ends();
+}
+
+ReservationQueue::Handle ReservationQueue::find(IdPool::Handle reader, IdPool::Handle book) const
+{
+    for (Handle h = byReader.value(reader).head; h != InvalidHandle;
+         h = nodes.at(h).nextByReader) {
+        if (nodes.at(h).book == book) {
+            return h;
+        }
+    }
+    return InvalidHandle;
+}
+
+QVector<IdPool::Handle> ReservationQueue::readersOf(IdPool::Handle book) const
+{
+    const Ends ends = byBook.value(book);
+    QVector<IdPool::Handle> result;
+    result.reserve(ends.count);
+    for (Handle h = ends.head; h != InvalidHandle; h = nodes.at(h).nextByBook) {
+        result.append(nodes.at(h).reader);
+    }
+    return result;
+}
+
+QVector<IdPool::Handle> ReservationQueue::booksOf(IdPool::Handle reader) const
+{
+    const Ends ends = byReader.value(reader);
+    QVector<IdPool::Handle> result;
+    result.reserve(ends.count);
+    for (Handle h = ends.head; h != InvalidHandle; h = nodes.at(h).nextByReader) {
+        result.append(nodes.at(h).book);
+    }
+    return result;
+}
+
+QVector<IdPool::Handle> ReservationQueue::queuedBooks() const
+{
+    QVector<IdPool::Handle> result;
+    result.reserve(byBook.size());
+    for (auto it = byBook.constBegin(); it != byBook.constEnd(); ++it) {
+        result.append(it.key());
+    }
+    return result;
+}
+
+QList<QPair<QString, QString>> ReservationQueue::toList() const
+{
+    QList<QPair<QString, QString>> result;
+    result.reserve(all.count);
+    for (Handle h = all.head; h != InvalidHandle; h = nodes.at(h).next) {
+        result.append(qMakePair(IdPool::string(nodes.at(h).reader),
+                                IdPool::string(nodes.at(h).book)));
+    }
+    return result;
+}
+
+// 把节点接到链表尾部，prev/next 指定使用节点中的哪一组链接
+void ReservationQueue::append(Ends &ends, Handle handle, Handle Node::*prev, Handle Node::*next)
+{
+    Node &node = nodes[handle];
+    node.*prev = ends.tail;
+    node.*next = InvalidHandle;
+    if (ends.tail != InvalidHandle) {
+        nodes[ends.tail].*next = handle;
+    } else {
+        ends.head = handle;
+    }
+    ends.tail = handle;
+    ends.count++;
+}
+
+void ReservationQueue::unlink(Ends &ends, Handle handle, Handle Node::*prev, Handle Node::*next)
+{
+    Node &node = nodes[handle];
+    if (node.*prev != InvalidHandle) {
+        nodes[node.*prev].*next = node.*next;
+    } else {
+        ends.head = node.*next;
+    }
+    if (node.*next != InvalidHandle) {
+        nodes[node.*next].*prev = node.*prev;
+    } else {
+        ends.tail = node.*prev;
+    }
+    ends.count--;
+}
@@ -0,0 +1,127 @@
+#include "sectionscanner.h"
+#include <cstring>
+
+namespace SectionScanner {
+
+namespace {
+
+bool isSpace(char c)
+{
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+// 去掉首尾空白后的 [begin, end)
+void trim(const char *&begin, const char *&end)
+{
+    while (begin < end && isSpace(*begin)) ++begin;
+    while (end > begin && isSpace(end[-1])) --end;
+}
+
+bool isCountedSection(const QByteArray &name)
+{
+    return name == "BOOKS" || name == "READERS" ||
+           name == "BORROWS" || name == "RESERVATIONS";
+}
+
+int parseCount(const char *begin, const char *end)
+{
+    trim(begin, end);
+    int value = 0;
+    for (const char *p = begin; p < end; ++p) {
+        if (*p < '0' || *p > '9') {
+            return 0;
+        }
+        value = value * 10 + (*p - '0');
+    }
+    return value;
+}
+
+} // namespace
+
+int nextLine(const char *&p, const char *end)
+{
+    const char *line = p;
+    const char *newline = static_cast<const char *>(std::memchr(p, '\n', end - p));
+    const char *lineEnd = newline ? newline : end;
+    p = newline ? newline + 1 : end;
+
+    if (lineEnd > line && lineEnd[-1] == '\r') {
+        --lineEnd;
+    }
+    return static_cast<int>(lineEnd - line);
+}
+
+QVector<Section> scan(const char *data, qint64 size, int linesPerChunk)
+{
+    QVector<Section> sections;
+    const char *p = data;
+    const char *end = data + size;
+
+    // 跳过 UTF-8 BOM
+    if (size >= 3 && std::memcmp(p, "\xEF\xBB\xBF", 3) == 0) {
+        p += 3;
+    }
+
+    while (p < end) {
+        const char *lineStart = p;
+        int length = nextLine(p, end);
+        const char *begin = lineStart;
+        const char *lineEnd = lineStart + length;
+        trim(begin, lineEnd);
+        if (begin == lineEnd || *begin != '#') {
+            continue;
+        }
+
+        Section section;
+        section.name = QByteArray(begin + 1, static_cast<int>(lineEnd - begin - 1));
+        section.headerOffset = lineStart - data;
+
+        if (isCountedSection(section.name)) {
+            const char *countLine = p;
+            int countLength = nextLine(p, end);
+            section.count = parseCount(countLine, countLine + countLength);
+
+            Chunk chunk{p, p};
+            int lines = 0;
+            for (int i = 0; i < section.count && p < end; ++i) {
+                nextLine(p, end);
+                if (++lines == linesPerChunk) {
+                    chunk.end = p;
+                    section.chunks.append(chunk);
+                    chunk.begin = p;
+                    lines = 0;
+                }
+            }
+            if (chunk.begin < p) {
+                chunk.end = p;
+                section.chunks.append(chunk);
+            }
+        } else {
+            // 非计数段延续到下一个段标记
+            section.count = -1;
+            Chunk chunk{p, p};
+            while (p < end) {
+                const char *next = p;
+                int nextLength = nextLine(next, end);
+                const char *b = p;
+                const char *e = p + nextLength;
+                trim(b, e);
+                if (b < e && *b == '#') {
+                    break;
+                }
+                p = next;
+            }
+            chunk.end = p;
+            if (chunk.begin < chunk.end) {
+                section.chunks.append(chunk);
+            }
+        }
+
+        section.endOffset = p - data;
+        sections.append(section);
+    }
+
+    return sections;
+}
+
+} // namespace SectionScanner
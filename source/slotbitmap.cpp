@@ -0,0 +1,102 @@
+#include "slotbitmap.h"
+#include <QtAlgorithms>
+#include <cstring>
+
+void SlotBitmap::insert(quint32 slot)
+{
+    auto it = blocks.find(slot / BlockBits);
+    if (it == blocks.end()) {
+        Block block;
+        std::memset(block.words, 0, sizeof(block.words));
+        block.count = 0;
+        it = blocks.insert(slot / BlockBits, block);
+    }
+
+    quint32 bit = slot % BlockBits;
+    quint64 mask = quint64(1) << (bit % 64);
+    quint64 &word = it->words[bit / 64];
+    if (!(word & mask)) {
+        word |= mask;
+        it->count++;
+        total++;
+    }
+}
+
+void SlotBitmap::remove(quint32 slot)
+{
+    auto it = blocks.find(slot / BlockBits);
+    if (it == blocks.end()) {
+        return;
+    }
+
+    quint32 bit = slot % BlockBits;
+    quint64 mask = quint64(1) << (bit % 64);
+    quint64 &word = it->words[bit / 64];
+    if (word & mask) {
+        word &= ~mask;
+        total--;
+        if (--it->count == 0) {
+            blocks.erase(it);
+        }
+    }
+}
+
+bool SlotBitmap::contains(quint32 slot) const
+{
+    auto it = blocks.constFind(slot / BlockBits);
+    if (it == blocks.constEnd()) {
+        return false;
+    }
+    quint32 bit = slot % BlockBits;
+    return (it->words[bit / 64] >> (bit % 64)) & 1;
+}
+
+void SlotBitmap::clear()
+{
+    blocks.clear();
+    total = 0;
+}
+
+QVector<quint32> SlotBitmap::toVector() const
+{
+    QVector<quint32> slots;
+    slots.reserve(total);
+    for (auto it = blocks.constBegin(); it != blocks.constEnd(); ++it) {
+        quint32 base = it.key() * BlockBits;
+        for (int w = 0; w < WordsPerBlock; ++w) {
+            quint64 word = it->words[w];
+            while (word) {
+                int bit = qCountTrailingZeroBits(word);
+                slots.append(base + w * 64 + bit);
+                word &= word - 1;
+            }
+        }
+    }
+    return slots;
+}
+
+SlotBitmap SlotBitmap::intersected(const SlotBitmap &a, const SlotBitmap &b)
+{
+    const SlotBitmap &smaller = (a.blocks.size() <= b.blocks.size()) ? a : b;
+    const SlotBitmap &larger = (&smaller == &a) ? b : a;
+
+    SlotBitmap result;
+    for (auto it = smaller.blocks.constBegin(); it != smaller.blocks.constEnd(); ++it) {
+        auto other = larger.blocks.constFind(it.key());
+        if (other == larger.blocks.constEnd()) {
+            continue;
+        }
+
+        Block block;
+        block.count = 0;
+        for (int w = 0; w < WordsPerBlock; ++w) {
+            block.words[w] = it->words[w] & other->words[w];
+            block.count += qPopulationCount(block.words[w]);
+        }
+        if (block.count > 0) {
+            result.blocks.insert(it.key(), block);
+            result.total += block.count;
+        }
+    }
+    return result;
+}
@@ -0,0 +1,461 @@
+#include "sqlitestorage.h"
+#include <QSqlError>
+#include <QVariant>
+#include <QDebug>
+
+namespace {
+
+// 日期以儒略日整数保存，无效日期保存为 NULL
+QVariant dayValue(const QDate &date)
+{
+    return date.isValid() ? QVariant(date.toJulianDay()) : QVariant();
+}
+
+QDate dateValue(const QVariant &value)
+{
+    return value.isNull() ? QDate() : QDate::fromJulianDay(value.toLongLong());
+}
+
+const char RecordColumns[] = "readerId, bookId, borrowDate, dueDate, returnDate";
+
+} // namespace
+
+struct SqliteStorage::Statements
+{
+    QSqlQuery saveBook;
+    QSqlQuery removeBook;
+    QSqlQuery saveReader;
+    QSqlQuery removeReader;
+    QSqlQuery addRecord;
+    QSqlQuery returnRecord;
+    QSqlQuery addReservation;
+    QSqlQuery removeReservation;
+    QSqlQuery saveSetting;
+    QSqlQuery allRecords;
+    QSqlQuery recordsByBook;
+    QSqlQuery recordsByReader;
+    QSqlQuery recentRecordsByReader;
+    QSqlQuery overdueRecords;
+    QSqlQuery recordsDueBetween;
+    QSqlQuery recordsBorrowedBetween;
+};
+
+SqliteStorage::SqliteStorage() :
+    connectionName(QString("library-storage-%1").arg(reinterpret_cast<quintptr>(this))),
+    inTransaction(false)
+{
+}
+
+SqliteStorage::~SqliteStorage()
+{
+    // 未提交的修改直接丢弃
+    rollback();
+    statements.reset();
+    if (db.isValid()) {
+        db.close();
+        db = QSqlDatabase();
+        QSqlDatabase::removeDatabase(connectionName);
+    }
+}
+
+bool SqliteStorage::isDatabaseFile(const QByteArray &header)
+{
+    return header.startsWith(QByteArray("SQLite format 3\0", 16));
+}
+
+bool SqliteStorage::open(const QString &filename)
+{
+    this->filename = filename;
+    db = QSqlDatabase::addDatabase("QSQLITE", connectionName);
+    db.setDatabaseName(filename);
+    if (!db.open()) {
+        qDebug() << "无法打开数据库：" << filename << db.lastError().text();
+        return false;
+    }
+
+    exec("PRAGMA journal_mode = WAL");
+    exec("PRAGMA synchronous = NORMAL");
+    return createSchema() && prepareStatements();
+}
+
+bool SqliteStorage::exec(const QString &sql)
+{
+    QSqlQuery query(db);
+    if (!query.exec(sql)) {
+        qDebug() << "数据库语句执行失败：" << sql << query.lastError().text();
+        return false;
+    }
+    return true;
+}
+
+bool SqliteStorage::createSchema()
+{
+    return exec("CREATE TABLE IF NOT EXISTS books ("
+                "id TEXT PRIMARY KEY, title TEXT, author TEXT, category INTEGER, "
+                "totalCopies INTEGER, availableCopies INTEGER, status INTEGER)") &&
+           exec("CREATE TABLE IF NOT EXISTS readers ("
+                "id TEXT PRIMARY KEY, name TEXT, dept TEXT, phone TEXT, "
+                "registerDate INTEGER, isValid INTEGER)") &&
+           exec("CREATE TABLE IF NOT EXISTS borrows ("
+                "id INTEGER PRIMARY KEY, readerId TEXT NOT NULL, bookId TEXT NOT NULL, "
+                "borrowDate INTEGER, dueDate INTEGER, returnDate INTEGER)") &&
+           exec("CREATE INDEX IF NOT EXISTS borrows_book ON borrows(bookId)") &&
+           exec("CREATE INDEX IF NOT EXISTS borrows_reader ON borrows(readerId)") &&
+           exec("CREATE INDEX IF NOT EXISTS borrows_return ON borrows(returnDate)") &&
+           exec("CREATE INDEX IF NOT EXISTS borrows_borrow ON borrows(borrowDate)") &&
+           exec("CREATE INDEX IF NOT EXISTS borrows_open_due ON borrows(dueDate) "
+                "WHERE returnDate IS NULL") &&
+           exec("CREATE TABLE IF NOT EXISTS reservations ("
+                "id INTEGER PRIMARY KEY, readerId TEXT NOT NULL, bookId TEXT NOT NULL)") &&
+           exec("CREATE TABLE IF NOT EXISTS settings (key TEXT PRIMARY KEY, value INTEGER)");
+}
+
+bool SqliteStorage::prepareStatements()
+{
+    statements.reset(new Statements);
+    const QString columns = RecordColumns;
+
+    struct {
+        QSqlQuery *query;
+        QString sql;
+    } list[] = {
+        {&statements->saveBook,
+         "INSERT OR REPLACE INTO books (id, title, author, category, totalCopies, "
+         "availableCopies, status) VALUES (?, ?, ?, ?, ?, ?, ?)"},
+        {&statements->removeBook, "DELETE FROM books WHERE id = ?"},
+        {&statements->saveReader,
+         "INSERT OR REPLACE INTO readers (id, name, dept, phone, registerDate, isValid) "
+         "VALUES (?, ?, ?, ?, ?, ?)"},
+        {&statements->removeReader, "DELETE FROM readers WHERE id = ?"},
+        {&statements->addRecord,
+         "INSERT INTO borrows (" + columns + ") VALUES (?, ?, ?, ?, ?)"},
+        {&statements->returnRecord,
+         "UPDATE borrows SET returnDate = ? WHERE id = ("
+         "SELECT id FROM borrows WHERE readerId = ? AND bookId = ? AND returnDate IS NULL "
+         "ORDER BY id LIMIT 1)"},
+        {&statements->addReservation, "INSERT INTO reservations (readerId, bookId) VALUES (?, ?)"},
+        {&statements->removeReservation,
+         "DELETE FROM reservations WHERE id = ("
+         "SELECT id FROM reservations WHERE readerId = ? AND bookId = ? ORDER BY id LIMIT 1)"},
+        {&statements->saveSetting, "INSERT OR REPLACE INTO settings (key, value) VALUES (?, ?)"},
+        {&statements->allRecords, "SELECT " + columns + " FROM borrows ORDER BY id"},
+        {&statements->recordsByBook,
+         "SELECT " + columns + " FROM borrows WHERE bookId = ? ORDER BY id"},
+        {&statements->recordsByReader,
+         "SELECT " + columns + " FROM borrows WHERE readerId = ? ORDER BY id"},
+        {&statements->recentRecordsByReader,
+         "SELECT " + columns + " FROM borrows WHERE id IN ("
+         "SELECT id FROM borrows WHERE readerId = ? ORDER BY id DESC LIMIT ?) ORDER BY id"},
+        {&statements->overdueRecords,
+         "SELECT " + columns + " FROM borrows WHERE returnDate IS NULL AND dueDate < ? "
+         "ORDER BY dueDate, id"},
+        {&statements->recordsDueBetween,
+         "SELECT " + columns + " FROM borrows WHERE returnDate IS NULL "
+         "AND dueDate BETWEEN ? AND ? ORDER BY dueDate, id"},
+        {&statements->recordsBorrowedBetween,
+         "SELECT " + columns + " FROM borrows WHERE borrowDate BETWEEN ? AND ? "
+         "ORDER BY borrowDate, id"},
+    };
+
+    for (auto &item : list) {
+        *item.query = QSqlQuery(db);
+        if (!item.query->prepare(item.sql)) {
+            qDebug() << "数据库语句预编译失败：" << item.sql << item.query->lastError().text();
+            return false;
+        }
+    }
+    return true;
+}
+
+// 第一次修改时开启事务，之后的修改都在同一个事务中
+void SqliteStorage::beginWrite()
+{
+    if (!inTransaction) {
+        inTransaction = db.transaction();
+    }
+}
+
+bool SqliteStorage::run(QSqlQuery &query) const
+{
+    if (!query.exec()) {
+        qDebug() << "数据库语句执行失败：" << query.lastQuery() << query.lastError().text();
+        return false;
+    }
+    return true;
+}
+
+bool SqliteStorage::commit()
+{
+    if (!inTransaction) {
+        return true;
+    }
+    if (!db.commit()) {
+        qDebug() << "数据库提交失败：" << db.lastError().text();
+        return false;
+    }
+    inTransaction = false;
+    return true;
+}
+
+void SqliteStorage::rollback()
+{
+    if (inTransaction) {
+        db.rollback();
+        inTransaction = false;
+    }
+}
+
+bool SqliteStorage::loadCatalog(LibrarySnapshot *catalog)
+{
+    QSqlQuery query(db);
+    query.setForwardOnly(true);
+
+    if (!query.exec("SELECT id, title, author, category, totalCopies, availableCopies, status "
+                    "FROM books ORDER BY id")) {
+        return false;
+    }
+    while (query.next()) {
+        Book book(query.value(0).toString(), query.value(1).toString(),
+                  query.value(2).toString(),
+                  static_cast<BookCategory>(query.value(3).toInt()),
+                  query.value(4).toInt(), query.value(5).toInt());
+        book.setStatus(static_cast<BookStatus>(query.value(6).toInt()));
+        catalog->books.append(book);
+    }
+
+    if (!query.exec("SELECT id, name, dept, phone, registerDate, isValid FROM readers ORDER BY id")) {
+        return false;
+    }
+    while (query.next()) {
+        Reader reader(query.value(0).toString(), query.value(1).toString(),
+                      query.value(2).toString(), query.value(3).toString());
+        reader.setRegisterDate(dateValue(query.value(4)));
+        reader.setValid(query.value(5).toInt() != 0);
+        catalog->readers.append(reader);
+    }
+
+    if (!query.exec("SELECT readerId, bookId FROM reservations ORDER BY id")) {
+        return false;
+    }
+    while (query.next()) {
+        catalog->reservations.append(qMakePair(query.value(0).toString(), query.value(1).toString()));
+    }
+
+    if (!query.exec("SELECT key, value FROM settings")) {
+        return false;
+    }
+    while (query.next()) {
+        QString key = query.value(0).toString();
+        if (key == "useCustomTime") {
+            catalog->useCustomTime = query.value(1).toInt() != 0;
+        } else if (key == "customDate") {
+            catalog->customCurrentDate = dateValue(query.value(1));
+        }
+    }
+    return true;
+}
+
+// 整个快照在一个事务中用预编译语句批量写入
+bool SqliteStorage::importSnapshot(const LibrarySnapshot &snapshot)
+{
+    clear();
+
+    for (const Book &book : snapshot.books) {
+        saveBook(book);
+    }
+    for (const Reader &reader : snapshot.readers) {
+        saveReader(reader);
+    }
+    if (snapshot.history) {
+        for (int i = 0; i < snapshot.history->size(); ++i) {
+            addBorrowRecord(snapshot.history->recordAt(i));
+        }
+    }
+    for (const BorrowRecord &record : snapshot.borrowRecords) {
+        addBorrowRecord(record);
+    }
+    for (const auto &reservation : snapshot.reservations) {
+        addReservation(reservation.first, reservation.second);
+    }
+    saveTimeSettings(snapshot.useCustomTime, snapshot.customCurrentDate);
+
+    return commit();
+}
+
+void SqliteStorage::saveBook(const Book &book)
+{
+    beginWrite();
+    QSqlQuery &query = statements->saveBook;
+    query.bindValue(0, book.getId());
+    query.bindValue(1, book.getTitle());
+    query.bindValue(2, book.getAuthor());
+    query.bindValue(3, static_cast<int>(book.getCategory()));
+    query.bindValue(4, book.getTotalCopies());
+    query.bindValue(5, book.getAvailableCopies());
+    query.bindValue(6, static_cast<int>(book.getStatus()));
+    run(query);
+}
+
+void SqliteStorage::removeBook(const QString &id)
+{
+    beginWrite();
+    statements->removeBook.bindValue(0, id);
+    run(statements->removeBook);
+}
+
+void SqliteStorage::saveReader(const Reader &reader)
+{
+    beginWrite();
+    QSqlQuery &query = statements->saveReader;
+    query.bindValue(0, reader.getId());
+    query.bindValue(1, reader.getName());
+    query.bindValue(2, reader.getDept());
+    query.bindValue(3, reader.getPhone());
+    query.bindValue(4, dayValue(reader.getRegisterDate()));
+    query.bindValue(5, reader.getIsValid() ? 1 : 0);
+    run(query);
+}
+
+void SqliteStorage::removeReader(const QString &id)
+{
+    beginWrite();
+    statements->removeReader.bindValue(0, id);
+    run(statements->removeReader);
+}
+
+void SqliteStorage::addBorrowRecord(const BorrowRecord &record)
+{
+    beginWrite();
+    QSqlQuery &query = statements->addRecord;
+    query.bindValue(0, record.getReaderId());
+    query.bindValue(1, record.getBookId());
+    query.bindValue(2, dayValue(record.getBorrowDate()));
+    query.bindValue(3, dayValue(record.getDueDate()));
+    query.bindValue(4, dayValue(record.getReturnDate()));
+    run(query);
+}
+
+bool SqliteStorage::returnBorrowRecord(const QString &readerId, const QString &bookId,
+                                       const QDate &returnDate)
+{
+    beginWrite();
+    QSqlQuery &query = statements->returnRecord;
+    query.bindValue(0, dayValue(returnDate));
+    query.bindValue(1, readerId);
+    query.bindValue(2, bookId);
+    return run(query) && query.numRowsAffected() > 0;
+}
+
+void SqliteStorage::addReservation(const QString &readerId, const QString &bookId)
+{
+    beginWrite();
+    statements->addReservation.bindValue(0, readerId);
+    statements->addReservation.bindValue(1, bookId);
+    run(statements->addReservation);
+}
+
+void SqliteStorage::removeReservation(const QString &readerId, const QString &bookId)
+{
+    beginWrite();
+    statements->removeReservation.bindValue(0, readerId);
+    statements->removeReservation.bindValue(1, bookId);
+    run(statements->removeReservation);
+}
+
+void SqliteStorage::saveTimeSettings(bool useCustomTime, const QDate &customDate)
+{
+    beginWrite();
+    QSqlQuery &query = statements->saveSetting;
+    query.bindValue(0, QString("useCustomTime"));
+    query.bindValue(1, useCustomTime ? 1 : 0);
+    run(query);
+    query.bindValue(0, QString("customDate"));
+    query.bindValue(1, dayValue(customDate));
+    run(query);
+}
+
+void SqliteStorage::clear()
+{
+    beginWrite();
+    exec("DELETE FROM books");
+    exec("DELETE FROM readers");
+    exec("DELETE FROM borrows");
+    exec("DELETE FROM reservations");
+    exec("DELETE FROM settings");
+}
+
+QVector<BorrowRecord> SqliteStorage::selectRecords(QSqlQuery &query) const
+{
+    QVector<BorrowRecord> records;
+    if (!run(query)) {
+        return records;
+    }
+    while (query.next()) {
+        records.append(recordFromQuery(query));
+    }
+    query.finish();
+    return records;
+}
+
+BorrowRecord SqliteStorage::recordFromQuery(const QSqlQuery &query)
+{
+    return BorrowRecord(query.value(0).toString(), query.value(1).toString(),
+                        dateValue(query.value(2)), dateValue(query.value(3)),
+                        dateValue(query.value(4)));
+}
+
+QVector<BorrowRecord> SqliteStorage::allBorrowRecords() const
+{
+    return selectRecords(statements->allRecords);
+}
+
+QVector<BorrowRecord> SqliteStorage::borrowRecordsByBook(const QString &bookId) const
+{
+    statements->recordsByBook.bindValue(0, bookId);
+    return selectRecords(statements->recordsByBook);
+}
+
+QVector<BorrowRecord> SqliteStorage::borrowRecordsByReader(const QString &readerId) const
+{
+    statements->recordsByReader.bindValue(0, readerId);
+    return selectRecords(statements->recordsByReader);
+}
+
+QVector<BorrowRecord> SqliteStorage::recentBorrowRecordsByReader(const QString &readerId,
+                                                                 int limit) const
+{
+    statements->recentRecordsByReader.bindValue(0, readerId);
+    statements->recentRecordsByReader.bindValue(1, limit);
+    return selectRecords(statements->recentRecordsByReader);
+}
+
+QVector<BorrowRecord> SqliteStorage::overdueRecords(const QDate &today) const
+{
+    statements->overdueRecords.bindValue(0, dayValue(today));
+    return selectRecords(statements->overdueRecords);
+}
+
+QVector<BorrowRecord> SqliteStorage::recordsDueBetween(const QDate &first, const QDate &last) const
+{
+    statements->recordsDueBetween.bindValue(0, dayValue(first));
+    statements->recordsDueBetween.bindValue(1, dayValue(last));
+    return selectRecords(statements->recordsDueBetween);
+}
+
+// 逐行交给 visit，不把整个区间读进内存
+void SqliteStorage::forEachBorrowedBetween(const QDate &first, const QDate &last,
+                                           const std::function<bool(const BorrowRecord &)> &visit) const
+{
+    QSqlQuery &query = statements->recordsBorrowedBetween;
+    query.bindValue(0, dayValue(first));
+    query.bindValue(1, dayValue(last));
+    if (!run(query)) {
+        return;
+    }
+    while (query.next()) {
+        if (!visit(recordFromQuery(query))) {
+            break;
+        }
+    }
+    query.finish();
+}